@@ -16,6 +16,9 @@ cd build/benchmark
 taskset 01 ./bench --benchmark_filter=init
 
 taskset 01 ./bench --benchmark_filter=long_words
+
+# Multithreaded, so not pinned to one cpu
+./bench --benchmark_filter=evaluate_boards
 )
 
 # https://unix.stackexchange.com/a/326585/358344
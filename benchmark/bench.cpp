@@ -6,15 +6,19 @@
 #include <cassert>
 #include <filesystem>
 #include <iostream>
+#include <random>
 #include <string>
 #include <string_view>
 #include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 using namespace std::literals;
 
-// Currently this uses macros and bypasses the solver::SolverFactory creation
-// for the dicts, therefore it doesn't measure the std::variant overhead too.
+// Currently this uses macros, and mostly bypasses the solver::SolverFactory
+// creation for the dicts. BENCH_SOLVER_WRAPPER() solves the same grid through
+// the std::variant, to compare against BENCH_SOLVER() of the same dict.
 // Converting this to use our own main() function and
 // benchmark::RegisterBenchmark is possible, but requires the underlying types
 // to be copy constructible, which currently some of the tries aren't.
@@ -31,6 +35,28 @@ static const auto grid = solver::make_grid(
 const std::size_t numb_threads =
     std::max(2U, std::thread::hardware_concurrency()) - 1U;
 
+// Random 4 x 4 boards back to back, letters weighted roughly as in English, as
+// when generating Boggle puzzles
+static const std::size_t numb_boggle_boards = 10000;
+static const auto boggle_boards = [] {
+  const std::string_view letters =
+      "eeeeeeeeeeeetttttttttaaaaaaaaooooooooiiiiiiinnnnnnnssssssrrrrrrhhhhhddd"
+      "llluuuccmmwwffggyyppbbvkjxqz";
+  std::mt19937 rng{42};
+  std::uniform_int_distribution<std::size_t> letter{0, letters.size() - 1};
+  std::string boards(numb_boggle_boards * 4 * 4, ' ');
+  for (auto& c : boards) {
+    c = letters[letter(rng)];
+  }
+  return boards;
+}();
+
+template <class Dict, class = void> struct has_data_size : std::false_type {};
+template <class Dict>
+struct has_data_size<Dict,
+                     std::void_t<decltype(std::declval<Dict>().data_size())>>
+    : std::true_type {};
+
 template <class Dict, class Grid>
 void bench_long_words(benchmark::State& state, const Dict& dict,
                       const Grid& grid) {
@@ -38,6 +64,24 @@ void bench_long_words(benchmark::State& state, const Dict& dict,
     benchmark::DoNotOptimize(solver::solve(dict, grid));
     benchmark::ClobberMemory();
   }
+  // Memory used, for the dicts that know it, to compare next to the times
+  if constexpr (has_data_size<Dict>::value) {
+    state.counters["bytes"] = benchmark::Counter(
+        static_cast<double>(dict.data_size()), benchmark::Counter::kDefaults,
+        benchmark::Counter::kIs1024);
+  }
+}
+
+template <class Dict>
+void bench_evaluate_boards(benchmark::State& state, const Dict& dict) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        solver::evaluate_boards(dict, boggle_boards, 4, 4, numb_threads));
+    benchmark::ClobberMemory();
+  }
+  state.counters["boards_per_second"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * numb_boggle_boards),
+      benchmark::Counter::kIsRate);
 }
 
 void bench_solver_init(benchmark::State& state,
@@ -62,6 +106,18 @@ void bench_solver_init(benchmark::State& state,
 // ->Repetitions(static_cast<int>(numb_threads))
 // ->MinTime(1)
 
+#define BENCH_SOLVER_WRAPPER(DictSolverArg)                                    \
+  BENCHMARK_CAPTURE(bench_long_words, DictSolverArg##_wrapper,                 \
+                    solver::SolverDictFactory{}.make(#DictSolverArg, dict),    \
+                    grid)                                                      \
+      ->Unit(benchmark::kMillisecond);
+
+// Real time, as evaluate_boards() spreads each iteration across threads
+#define BENCH_EVALUATE_BOARDS(Dict)                                            \
+  BENCHMARK_CAPTURE(bench_evaluate_boards, Dict, Dict{dict})                   \
+      ->Unit(benchmark::kMillisecond)                                          \
+      ->UseRealTime();
+
 // BENCH_SOLVER(compact_trie::CompactTrie)
 // BENCH_SOLVER(compact_trie2::CompactTrie2)
 
@@ -73,24 +129,60 @@ void bench_solver_init(benchmark::State& state,
 #ifdef WORDSEARCH_SOLVER_HAS_trie
 BENCH_SOLVER_INIT(trie)
 BENCH_SOLVER(trie::Trie)
+BENCH_SOLVER_WRAPPER(trie)
+BENCH_EVALUATE_BOARDS(trie::Trie)
 #endif
 #ifdef WORDSEARCH_SOLVER_HAS_compact_trie
 BENCH_SOLVER_INIT(compact_trie)
 BENCH_SOLVER(compact_trie::CompactTrie)
+BENCH_SOLVER_WRAPPER(compact_trie)
+BENCH_EVALUATE_BOARDS(compact_trie::CompactTrie)
 #endif
 #ifdef WORDSEARCH_SOLVER_HAS_compact_trie2
 BENCH_SOLVER_INIT(compact_trie2)
 BENCH_SOLVER(compact_trie2::CompactTrie2)
+BENCH_SOLVER_WRAPPER(compact_trie2)
+BENCH_EVALUATE_BOARDS(compact_trie2::CompactTrie2)
+#endif
+#ifdef WORDSEARCH_SOLVER_HAS_compact_trie3
+BENCH_SOLVER_INIT(compact_trie3)
+BENCH_SOLVER(compact_trie3::CompactTrie3)
+BENCH_SOLVER_WRAPPER(compact_trie3)
+BENCH_EVALUATE_BOARDS(compact_trie3::CompactTrie3)
+#endif
+#ifdef WORDSEARCH_SOLVER_HAS_double_array_trie
+BENCH_SOLVER_INIT(double_array_trie)
+BENCH_SOLVER(double_array_trie::DoubleArrayTrie)
+BENCH_SOLVER_WRAPPER(double_array_trie)
+BENCH_EVALUATE_BOARDS(double_array_trie::DoubleArrayTrie)
+#endif
+#ifdef WORDSEARCH_SOLVER_HAS_dawg
+BENCH_SOLVER_INIT(dawg)
+BENCH_SOLVER(dawg::Dawg)
+BENCH_SOLVER_WRAPPER(dawg)
+BENCH_EVALUATE_BOARDS(dawg::Dawg)
+#endif
+#ifdef WORDSEARCH_SOLVER_HAS_louds_trie
+BENCH_SOLVER_INIT(louds_trie)
+BENCH_SOLVER(louds_trie::LoudsTrie)
+BENCH_SOLVER_WRAPPER(louds_trie)
+BENCH_EVALUATE_BOARDS(louds_trie::LoudsTrie)
 #endif
 #ifdef WORDSEARCH_SOLVER_HAS_dictionary_std_vector
 BENCH_SOLVER_INIT(dictionary_std_vector)
 BENCH_SOLVER(dictionary_std_vector::DictionaryStdVector)
+BENCH_SOLVER_WRAPPER(dictionary_std_vector)
+BENCH_EVALUATE_BOARDS(dictionary_std_vector::DictionaryStdVector)
 #endif
 #ifdef WORDSEARCH_SOLVER_HAS_dictionary_std_set
 BENCH_SOLVER_INIT(dictionary_std_set)
 BENCH_SOLVER(dictionary_std_set::DictionaryStdSet)
+BENCH_SOLVER_WRAPPER(dictionary_std_set)
+BENCH_EVALUATE_BOARDS(dictionary_std_set::DictionaryStdSet)
 #endif
 
+#undef BENCH_EVALUATE_BOARDS
+#undef BENCH_SOLVER_WRAPPER
 #undef BENCH_SOLVER
 #undef BENCH_SOLVER_INIT
 
@@ -12,7 +12,7 @@ set -o pipefail
 
 dict=test/test_cases/dictionary.txt
 wordsearch=test/test_cases/massive_wordsearch.txt
-solvers=("trie" "compact_trie" "compact_trie2" "dictionary_std_vector" "dictionary_std_set")
+solvers=("trie" "compact_trie" "compact_trie2" "compact_trie3" "double_array_trie" "dawg" "louds_trie" "dictionary_std_vector" "dictionary_std_set")
 
 for solver in "${solvers[@]}"
 do
@@ -33,6 +33,10 @@ int main(int argc, char** argv) {
     ("s,solver", "Dictionary solver implementation",
      cxxopts::value<std::string>())
     ("size", "Print size of dict_solver")
+    ("t,threads", "Number of threads to solve with, 0 for all cores",
+     cxxopts::value<std::size_t>()->default_value("1"))
+    ("work-stealing", "With multiple threads, split up expensive start cells "
+     "between threads")
     ("h,help", "Help")
     ;
   // clang-format on
@@ -50,6 +54,10 @@ int main(int argc, char** argv) {
   std::string wordsearch_path;
   std::string solver;
   const bool print_size = parsed_args["size"].as<bool>();
+  const auto numb_threads = parsed_args["threads"].as<std::size_t>();
+  const auto schedule = parsed_args["work-stealing"].as<bool>()
+                            ? solver::Schedule::work_stealing
+                            : solver::Schedule::chunked;
 
   // Pretty crap seem to have to define these exceptions manually, as otherwise
   // you get a useless error if pass only one of the arguments
@@ -101,7 +109,7 @@ int main(int argc, char** argv) {
   ProfilerRestartDisabled();
   ProfilerEnable();
   const auto start = std::chrono::high_resolution_clock::now();
-  const auto result = solver::solve(solver_dict, grid);
+  const auto result = solver::solve(solver_dict, grid, numb_threads, schedule);
   const auto end = std::chrono::high_resolution_clock::now();
   std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(end -
                                                                      start)
@@ -11,9 +11,11 @@
 #include <range/v3/view/subrange.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <initializer_list>
 #include <iterator>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <string_view>
@@ -29,10 +31,9 @@
 // sure if "trivial" means what I think it does anyway, remove this likely..
 // TODO: maybe look into units library for the ascii/index conversion stuff, as
 // that has already wasted a significant amount of time with offset stuff
-// TODO: std::bitset size on this system is 8 bytes, even though it need only be
-// 4 bytes (26 bits) for lowercase ascii. Could see if writing own node without
-// std::bitset that is 4 bytes big changes performance due to whole thing being
-// approx half size (better for cache).
+// NOTE: std::bitset size on this system is 8 bytes, even though it need only be
+// 4 bytes (26 bits) for lowercase ascii. compact_trie3 is this with its own 8
+// byte node, to see how much the halved size helps.
 
 /** namespace compact_trie */
 namespace compact_trie {
@@ -76,6 +77,8 @@ public:
   using RowsIterator = Rows::const_iterator;
   using const_iterator = std::tuple<NodesIterator, RowsIterator>;
   // static_assert(std::is_trivially_copyable_v<const_iterator>);
+  /** @copydoc solver::SolverDictWrapper::Cursor */
+  using Cursor = const_iterator;
 
   CompactTrie() = default;
 
@@ -89,12 +92,21 @@ public:
   CompactTrie(const std::initializer_list<std::string>& words);
   CompactTrie(const std::initializer_list<const char*>& words);
 
-  template <class Iterator1, class Iterator2>
+  template <class Iterator1, class Iterator2,
+            std::enable_if_t<!std::is_integral_v<Iterator2>, int> = 0>
   CompactTrie(Iterator1 first, const Iterator2 last);
 
   /** Actual constructor, all other delegate to this. */
   template <class Strings> explicit CompactTrie(Strings&& strings_in);
 
+  /** Constructs from only the words in @p strings_in that are at most
+   * @p max_length long, so that there are no rows deeper than @p max_length.
+   * For solve() with a solver::LengthLimits::max_length, which never looks
+   * for longer words.
+   */
+  template <class Strings>
+  CompactTrie(Strings&& strings_in, std::size_t max_length);
+
   /** @copydoc solver::SolverDictWrapper::contains() */
   bool contains(std::string_view word) const;
   /** @copydoc solver::SolverDictWrapper::further() */
@@ -105,8 +117,23 @@ public:
   void contains_further(std::string_view stem, std::string_view suffixes,
                         OutputIterator contains_further_it) const;
 
+  /** @copydoc solver::SolverDictWrapper::root() */
+  Cursor root() const;
+  /** @copydoc solver::SolverDictWrapper::child() */
+  std::optional<Cursor> child(Cursor cursor, char c) const;
+  /** @copydoc solver::SolverDictWrapper::is_word() */
+  bool is_word(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::has_further() */
+  bool has_further(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::word_id() */
+  std::size_t word_id(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::word() */
+  std::string word(std::size_t id) const;
+
   std::size_t size() const;
   bool empty() const;
+  /** @copydoc solver::SolverDictWrapper::max_word_length() */
+  std::size_t max_word_length() const;
 
   friend std::ostream& operator<<(std::ostream& os, const CompactTrie& ct);
 
@@ -134,9 +161,20 @@ private:
          ranges::subrange<CompactTrie::NodesIterator> nodes,
          ranges::subrange<CompactTrie::RowsIterator> rows) const;
 
+  /** Fill in first_word_ids_ once nodes_ and rows_ are built */
+  void assign_word_ids();
+
+  /** @returns The id of the first word, in sorted order, with the prefix of
+   * the node @p cursor is at
+   */
+  std::size_t first_word_id(Cursor cursor) const;
+
   Nodes nodes_;
   Rows rows_;
+  /** Parallel to nodes_, see first_word_id() */
+  std::vector<std::uint32_t> first_word_ids_;
   std::size_t size_;
+  std::size_t max_word_length_ = 0;
 };
 
 } // namespace compact_trie
@@ -8,11 +8,13 @@
 #include <range/v3/view/enumerate.hpp>
 #include <range/v3/view/subrange.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <iterator>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 namespace compact_trie {
@@ -20,12 +22,18 @@ namespace compact_trie {
 // FIXME: this would use ranges::subrange as we don't need to alloc. However
 // this won't compile due to std::tuple_element on incomplete class (on gcc with
 // -fconcepts at least) so leaving like this for now.
-template <class Iterator1, class Iterator2>
+template <class Iterator1, class Iterator2,
+          std::enable_if_t<!std::is_integral_v<Iterator2>, int>>
 CompactTrie::CompactTrie(Iterator1 first, const Iterator2 last)
     : CompactTrie(std::vector<std::string>(first, last)) {}
 
 template <class Strings>
-CompactTrie::CompactTrie(Strings&& strings_in) : nodes_{}, rows_{}, size_{0} {
+CompactTrie::CompactTrie(Strings&& strings_in, const std::size_t max_length)
+    : CompactTrie(utility::words_up_to_length(strings_in, max_length)) {}
+
+template <class Strings>
+CompactTrie::CompactTrie(Strings&& strings_in)
+    : nodes_{}, rows_{}, first_word_ids_{}, size_{0} {
   // FIXME: change this, this is here for quick dirty testing
   std::vector<std::string> strings(strings_in.begin(), strings_in.end());
   ranges::sort(strings);
@@ -42,6 +50,9 @@ CompactTrie::CompactTrie(Strings&& strings_in) : nodes_{}, rows_{}, size_{0} {
     std::size_t bits_on = 0;
     for (auto [prefix, suffixes, is_end_of_word] : row) {
       size_ += is_end_of_word;
+      if (is_end_of_word) {
+        max_word_length_ = std::max(max_word_length_, prefix.size());
+      }
       // fmt::print("{} {} {}\n", prefix, suffixes, is_end_of_word);
       Node comp{};
       for (const char c : suffixes) {
@@ -64,6 +75,8 @@ CompactTrie::CompactTrie(Strings&& strings_in) : nodes_{}, rows_{}, size_{0} {
   for (const auto index : rows_indexes) {
     rows_.push_back(std::next(nodes_.begin(), static_cast<long>(index)));
   }
+
+  this->assign_word_ids();
 }
 
 template <class OutputIterator>
@@ -13,11 +13,17 @@
 #include <range/v3/view/transform.hpp>
 #include <range/v3/view/zip.hpp>
 
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 // This might ACTUALLY be a case for inheritance what with the CompactTrie being
 // a Trie?
@@ -77,6 +83,8 @@ std::size_t CompactTrie::size() const { return size_; }
 
 bool CompactTrie::empty() const { return size_ == 0; }
 
+std::size_t CompactTrie::max_word_length() const { return max_word_length_; }
+
 std::ostream& operator<<(std::ostream& os, const CompactTrie& ct) {
   fmt::memory_buffer buff{};
   fmt::format_to(buff, "Size: {}\n", ct.size());
@@ -176,4 +184,96 @@ CompactTrie::const_iterator CompactTrie::search(
   return {it, rows_it};
 }
 
+CompactTrie::Cursor CompactTrie::root() const {
+  return {nodes_.begin(), rows_.begin()};
+}
+
+// The root of an empty CompactTrie is nodes_.end(), so that is checked for
+std::optional<CompactTrie::Cursor> CompactTrie::child(const Cursor cursor,
+                                                      const char c) const {
+  const auto [node_it, rows_it] = cursor;
+  if (node_it == nodes_.end()) {
+    return {};
+  }
+  const auto next_it = follow(node_it, rows_it, static_cast<std::uint8_t>(c),
+                              nodes_.end(), rows_.end());
+  if (next_it == nodes_.end()) {
+    return {};
+  }
+  return Cursor{next_it, std::next(rows_it)};
+}
+
+bool CompactTrie::is_word(const Cursor cursor) const {
+  const auto node_it = std::get<NodesIterator>(cursor);
+  return node_it != nodes_.end() && node_it->is_end_of_word();
+}
+
+bool CompactTrie::has_further(const Cursor cursor) const {
+  const auto node_it = std::get<NodesIterator>(cursor);
+  return node_it != nodes_.end() && node_it->any();
+}
+
+std::size_t CompactTrie::first_word_id(const Cursor cursor) const {
+  const auto node_it = std::get<NodesIterator>(cursor);
+  return first_word_ids_[static_cast<std::size_t>(
+      std::distance(nodes_.begin(), node_it))];
+}
+
+std::size_t CompactTrie::word_id(const Cursor cursor) const {
+  assert(this->is_word(cursor));
+  return this->first_word_id(cursor);
+}
+
+std::string CompactTrie::word(const std::size_t id) const {
+  if (id >= size_) {
+    throw std::out_of_range("Word id out of range of compact trie");
+  }
+  std::string word;
+  auto cursor = this->root();
+  while (!(this->is_word(cursor) && this->first_word_id(cursor) == id)) {
+    // Each child's words follow on from its previous sibling's, so id is under
+    // the last child whose first word id isn't greater than it
+    std::optional<Cursor> next;
+    char next_c = 0;
+    for (char c = 'a'; c <= 'z'; ++c) {
+      const auto child = this->child(cursor, c);
+      if (!child) {
+        continue;
+      }
+      if (this->first_word_id(*child) > id) {
+        break;
+      }
+      next = child;
+      next_c = c;
+    }
+    assert(next);
+    word.push_back(next_c);
+    cursor = *next;
+  }
+  return word;
+}
+
+void CompactTrie::assign_word_ids() {
+  first_word_ids_.assign(nodes_.size(), 0);
+  if (nodes_.empty()) {
+    return;
+  }
+  // Preorder traversal, children in letter order, visits words in sorted order
+  std::uint32_t next_id = 0;
+  std::vector<Cursor> stack{this->root()};
+  while (!stack.empty()) {
+    const auto cursor = stack.back();
+    stack.pop_back();
+    const auto node_it = std::get<NodesIterator>(cursor);
+    first_word_ids_[static_cast<std::size_t>(
+        std::distance(nodes_.begin(), node_it))] = next_id;
+    next_id += node_it->is_end_of_word();
+    for (char c = 'z'; c >= 'a'; --c) {
+      if (const auto child = this->child(cursor, c)) {
+        stack.push_back(*child);
+      }
+    }
+  }
+}
+
 } // namespace compact_trie
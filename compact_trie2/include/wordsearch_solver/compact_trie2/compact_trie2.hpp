@@ -4,14 +4,15 @@
 #include "wordsearch_solver/compact_trie2/compact_trie2_iterator_typedefs.hpp"
 #include "wordsearch_solver/compact_trie2/empty_node_view.hpp"
 #include "wordsearch_solver/compact_trie2/full_node_view.hpp"
-#include "wordsearch_solver/utility/flat_char_value_map.hpp"
 
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -86,9 +87,18 @@ namespace compact_trie2 {
  * std::vector<std::uint8_t>::iterator won't work as you are in a const member
  * function and therefore pass them std::vector<std::uint8_t>::const_iterator.
  *
+ * Immutable once constructed, so safe to read from multiple threads at once.
  */
 class CompactTrie2 {
 public:
+  /** @copydoc solver::SolverDictWrapper::Cursor */
+  struct Cursor {
+    /** The node */
+    DataIterator it;
+    /** The row the node is in */
+    RowIterator rows_it;
+  };
+
   CompactTrie2() = default;
 
   CompactTrie2(CompactTrie2&&) = default;
@@ -101,7 +111,8 @@ public:
   CompactTrie2(const std::initializer_list<std::string>& words);
   CompactTrie2(const std::initializer_list<const char*>& words);
 
-  template <class Iterator1, class Iterator2>
+  template <class Iterator1, class Iterator2,
+            std::enable_if_t<!std::is_integral_v<Iterator2>, int> = 0>
   CompactTrie2(Iterator1 first, const Iterator2 last);
 
   // TODO: awful SFINAE or wait until 2030 for widespread cpp20 concepts to
@@ -116,6 +127,16 @@ public:
    */
   template <class ForwardRange> explicit CompactTrie2(ForwardRange&& words);
 
+  /** Constructs from only the words in @p words that are at most
+   * @p max_length long, so that there are no rows deeper than @p max_length
+   *
+   * @param[in] words As for the constructor above, but always copied
+   * @param[in] max_length Length of the longest words to keep, such as the
+   * solver::LengthLimits::max_length that solve() is given
+   */
+  template <class ForwardRange>
+  CompactTrie2(ForwardRange&& words, std::size_t max_length);
+
   std::size_t size() const;
 
   /** Size of underlying data store in bytes. */
@@ -123,6 +144,9 @@ public:
 
   bool empty() const;
 
+  /** @copydoc solver::SolverDictWrapper::max_word_length() */
+  std::size_t max_word_length() const;
+
   /** @copydoc solver::SolverDictWrapper::contains() */
   bool contains(const std::string_view word) const;
 
@@ -135,6 +159,19 @@ public:
                         const std::string_view suffixes,
                         OutputIterator contains_further_it) const;
 
+  /** @copydoc solver::SolverDictWrapper::root() */
+  Cursor root() const;
+  /** @copydoc solver::SolverDictWrapper::child() */
+  std::optional<Cursor> child(Cursor cursor, char c) const;
+  /** @copydoc solver::SolverDictWrapper::is_word() */
+  bool is_word(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::has_further() */
+  bool has_further(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::word_id() */
+  std::size_t word_id(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::word() */
+  std::string word(std::size_t id) const;
+
   friend std::ostream& operator<<(std::ostream& os, const CompactTrie2& ct);
 
 private:
@@ -147,6 +184,14 @@ private:
    */
   void non_templated_rest_of_init();
 
+  /** Fill in first_word_ids_, called by non_templated_rest_of_init() */
+  void assign_word_ids();
+
+  /** @returns The id of the first word, in sorted order, with the prefix of
+   * the node @p cursor is at
+   */
+  std::size_t first_word_id(Cursor cursor) const;
+
   /** Search through @p word as far as possible, starting at the node @p it in
    * the row @p rows_it. If the trie contains @p word, then the returned
    * `std::size_t` will be equal to @p word.size().
@@ -167,9 +212,12 @@ private:
 
   ContiguousContainer data_;
   std::vector<ContiguousContainerIterator> rows_;
+  /** Offset into data_ of every node, and its first_word_id(), sorted by
+   * offset. Nodes vary in size so can't be numbered by position.
+   */
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> first_word_ids_;
   std::size_t size_;
-  mutable utility::FlatCharValueMap<std::pair<DataIterator, RowIterator>>
-      cache_;
+  std::size_t max_word_length_ = 0;
 };
 
 } // namespace compact_trie2
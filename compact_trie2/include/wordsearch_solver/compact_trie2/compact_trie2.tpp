@@ -6,7 +6,6 @@
 
 #include "wordsearch_solver/compact_trie2/empty_node_view.hpp"
 #include "wordsearch_solver/compact_trie2/full_node_view.hpp"
-#include "wordsearch_solver/utility/flat_char_value_map.hpp"
 #include "wordsearch_solver/utility/utility.hpp"
 
 #include <fmt/core.h>
@@ -29,6 +28,7 @@
 #include <range/v3/view/unique.hpp>
 #include <range/v3/view/zip.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
@@ -161,10 +161,15 @@ template <class T> constexpr void sort_if_possible(T&& t) {
 // Currently gcc8 complains with "-fconcepts" about incomplete type with
 // std::tuple_element if I instead pass ranges::subrange(first, last).
 // Not sure exactly why this is, but this is my temporary fix for now
-template <class Iterator1, class Iterator2>
+template <class Iterator1, class Iterator2,
+          std::enable_if_t<!std::is_integral_v<Iterator2>, int>>
 CompactTrie2::CompactTrie2(Iterator1 first, const Iterator2 last)
     : CompactTrie2(std::vector<std::string>(first, last)) {}
 
+template <class ForwardRange>
+CompactTrie2::CompactTrie2(ForwardRange&& words, const std::size_t max_length)
+    : CompactTrie2(utility::words_up_to_length(words, max_length)) {}
+
 // Member functions in this class that could be const aren't because the
 // EmptyNodeView and FullNodeView classes wrap iterators. These iterators are
 // into data_'s type (std::vector<std::uint8_t>). However FullNodeView
@@ -179,7 +184,7 @@ CompactTrie2::CompactTrie2(Iterator1 first, const Iterator2 last)
 // constrain this to a ForwardRange
 template <class ForwardRange>
 CompactTrie2::CompactTrie2(ForwardRange&& words)
-    : data_(), rows_{}, size_(0), cache_() {
+    : data_(), rows_{}, first_word_ids_{}, size_(0) {
 
   // Just not going to handle these. Need deep not pointer comparator and call
   // strlen to get size etc
@@ -223,6 +228,9 @@ template <class T> void CompactTrie2::init(const T& words_view) {
     // const auto old_row_end = static_cast<long>(data.size());
     for (auto [prefix, suffixes, is_end_of_word] : words_by_length) {
       size_ += is_end_of_word;
+      if (is_end_of_word) {
+        max_word_length_ = std::max(max_word_length_, prefix.size());
+      }
       make_node(suffixes, is_end_of_word, data_insert_iter);
       // fmt::print("{} -> {}, end_of_word: {}\n", prefix,
       // suffixes | ranges::to<std::vector>(), is_end_of_word);
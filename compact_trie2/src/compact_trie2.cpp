@@ -27,10 +27,12 @@
 #include <limits>
 #include <optional>
 #include <ostream>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 namespace compact_trie2 {
 
@@ -250,6 +252,78 @@ void CompactTrie2::non_templated_rest_of_init() {
       }
     }
   }
+
+  this->assign_word_ids();
+}
+
+void CompactTrie2::assign_word_ids() {
+  first_word_ids_.clear();
+  if (this->empty()) {
+    return;
+  }
+  // Preorder traversal, children in letter order, visits words in sorted order
+  std::uint32_t next_id = 0;
+  std::vector<Cursor> stack{this->root()};
+  while (!stack.empty()) {
+    const auto cursor = stack.back();
+    stack.pop_back();
+    first_word_ids_.emplace_back(
+        static_cast<std::uint32_t>(std::distance(data_.cbegin(), cursor.it)),
+        next_id);
+    next_id += this->is_word(cursor);
+    for (char c = 'z'; c >= 'a'; --c) {
+      if (const auto child = this->child(cursor, c)) {
+        stack.push_back(*child);
+      }
+    }
+  }
+  std::sort(first_word_ids_.begin(), first_word_ids_.end());
+}
+
+std::size_t CompactTrie2::first_word_id(const Cursor cursor) const {
+  const auto offset =
+      static_cast<std::uint32_t>(std::distance(data_.cbegin(), cursor.it));
+  const auto it = std::lower_bound(
+      first_word_ids_.begin(), first_word_ids_.end(), offset,
+      [](const auto& entry, const std::uint32_t value) {
+        return entry.first < value;
+      });
+  assert(it != first_word_ids_.end() && it->first == offset);
+  return it->second;
+}
+
+std::size_t CompactTrie2::word_id(const Cursor cursor) const {
+  assert(this->is_word(cursor));
+  return this->first_word_id(cursor);
+}
+
+std::string CompactTrie2::word(const std::size_t id) const {
+  if (id >= size_) {
+    throw std::out_of_range("Word id out of range of compact trie2");
+  }
+  std::string word;
+  auto cursor = this->root();
+  while (!(this->is_word(cursor) && this->first_word_id(cursor) == id)) {
+    // Each child's words follow on from its previous sibling's, so id is under
+    // the last child whose first word id isn't greater than it
+    std::optional<Cursor> next;
+    char next_c = 0;
+    for (char c = 'a'; c <= 'z'; ++c) {
+      const auto child = this->child(cursor, c);
+      if (!child) {
+        continue;
+      }
+      if (this->first_word_id(*child) > id) {
+        break;
+      }
+      next = child;
+      next_c = c;
+    }
+    assert(next);
+    word.push_back(next_c);
+    cursor = *next;
+  }
+  return word;
 }
 
 std::size_t CompactTrie2::size() const { return size_; }
@@ -258,20 +332,48 @@ std::size_t CompactTrie2::data_size() const { return data_.size(); }
 
 bool CompactTrie2::empty() const { return this->size() == 0; }
 
+std::size_t CompactTrie2::max_word_length() const { return max_word_length_; }
+
 bool CompactTrie2::contains(const std::string_view word) const {
   if (this->empty())
     return false;
-  auto [i, it, rows_it] = this->search(word, data_.begin(), rows_.begin());
+  auto [i, it, rows_it] =
+      this->search(word, data_.begin(), rows_.begin());
   return i == word.size() && node_is_end_of_word(it);
 }
 
 bool CompactTrie2::further(const std::string_view word) const {
   if (this->empty())
     return false;
-  auto [i, it, rows_it] = this->search(word, data_.begin(), rows_.begin());
+  auto [i, it, rows_it] =
+      this->search(word, data_.begin(), rows_.begin());
   return i == word.size() && node_data_size(it) > 0;
 }
 
+CompactTrie2::Cursor CompactTrie2::root() const {
+  return {data_.begin(), rows_.begin()};
+}
+
+std::optional<CompactTrie2::Cursor> CompactTrie2::child(const Cursor cursor,
+                                                        const char c) const {
+  if (this->empty())
+    return {};
+  const std::optional<std::size_t> next_row_offset =
+      next_node_offset(cursor.it, c);
+  if (!next_row_offset)
+    return {};
+  const auto rows_it = std::next(cursor.rows_it);
+  return Cursor{*rows_it + static_cast<long>(*next_row_offset), rows_it};
+}
+
+bool CompactTrie2::is_word(const Cursor cursor) const {
+  return !this->empty() && node_is_end_of_word(cursor.it);
+}
+
+bool CompactTrie2::has_further(const Cursor cursor) const {
+  return !this->empty() && node_data_size(cursor.it) > 0;
+}
+
 // it -> data iterator
 // rows_it -> the row of that iterator (will be ++ to get the next row start)
 // i -> index, if i == word.size() found end
@@ -281,20 +383,12 @@ CompactTrie2::search(const std::string_view word, DataIterator it,
                      RowIterator rows_it) const {
   assert(!this->empty());
 
-  const bool use_cache = it == data_.begin();
-
   // fmt::print("\nSearching for word: {}\n", word);
 
   // auto it = data_.begin();
   // auto rows_it = rows_.begin();
 
   std::size_t i = 0;
-  if (use_cache) {
-    const auto* cached_result = cache_.lookup(word, i);
-    if (cached_result) {
-      std::tie(it, rows_it) = *cached_result;
-    }
-  }
 
   for (; i < word.size();) {
     const char c = word[i];
@@ -313,8 +407,6 @@ CompactTrie2::search(const std::string_view word, DataIterator it,
     // static_cast<long>(*next_row_offset);
     it = *rows_it + static_cast<long>(*next_row_offset);
     ++i;
-    if (use_cache)
-      cache_.append(c, {it, rows_it});
   }
 
   assert(i == word.size());
@@ -0,0 +1,46 @@
+#ifndef COMPACT_TRIE3_TPP
+#define COMPACT_TRIE3_TPP
+
+#include "wordsearch_solver/compact_trie3/compact_trie3.hpp"
+#include "wordsearch_solver/utility/utility.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace compact_trie3 {
+
+template <class Iterator1, class Iterator2,
+          std::enable_if_t<!std::is_integral_v<Iterator2>, int>>
+CompactTrie3::CompactTrie3(Iterator1 first, const Iterator2 last)
+    : CompactTrie3() {
+  this->init(std::vector<std::string>(first, last));
+}
+
+template <class Strings>
+CompactTrie3::CompactTrie3(const Strings& strings_in)
+    : CompactTrie3(strings_in.begin(), strings_in.end()) {}
+
+template <class Strings>
+CompactTrie3::CompactTrie3(const Strings& strings_in,
+                           const std::size_t max_length)
+    : CompactTrie3(utility::words_up_to_length(strings_in, max_length)) {}
+
+template <class OutputIterator>
+void CompactTrie3::contains_further(const std::string_view stem,
+                                    const std::string_view suffixes,
+                                    OutputIterator contains_further_it) const {
+  const auto cursor = this->search(stem);
+  for (const auto c : suffixes) {
+    const auto child = cursor ? this->child(*cursor, c) : std::nullopt;
+    *contains_further_it++ = {child && this->is_word(*child),
+                              child && this->has_further(*child)};
+  }
+}
+
+} // namespace compact_trie3
+
+#endif // COMPACT_TRIE3_TPP
@@ -0,0 +1,87 @@
+#ifndef COMPACT_TRIE3_NODE_HPP
+#define COMPACT_TRIE3_NODE_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+namespace compact_trie3 {
+
+/** 8 byte node, a 32 bit mask of letters and end of word, and the index of its
+ * first child.
+ *
+ * compact_trie::Node is 16 bytes, as its `std::bitset<26>` is backed by an
+ * `unsigned long`. Here the 26 letter bits and the end of word bit share one
+ * `std::uint32_t`, and the other holds the index of the first child in the
+ * whole trie, rather than the count of nodes before it on its row.
+ *
+ * Defined here rather than in a .cpp so that child lookups inline to a mask
+ * and a popcount.
+ */
+class Node {
+public:
+  Node() = default;
+
+  /** @param[in] i Letter to add, 0 == 'a', 1 == 'b'... */
+  void add_letter(const std::size_t i) {
+    assert(i < 26);
+    bits_ |= std::uint32_t{1} << i;
+  }
+
+  void set_first_child(const std::uint32_t first_child) {
+    first_child_ = first_child;
+  }
+
+  void set_is_end_of_word(const bool is_end_of_word) {
+    bits_ = is_end_of_word ? bits_ | end_of_word_bit : bits_ & letter_bits;
+  }
+
+  /** O(1) test if a letter is present.
+   * @param[in] i Letter to test, 0 == 'a', 1 == 'b'... Must be less than 26
+   */
+  bool test(const std::size_t i) const {
+    assert(i < 26);
+    return (bits_ >> i) & 1U;
+  }
+
+  /** @returns Index of the child for letter @p i in the whole trie. Only valid
+   * if test() is true for @p i.
+   * @param[in] i Letter, 0 == 'a', 1 == 'b'... Must be less than 26
+   */
+  std::uint32_t child(const std::size_t i) const {
+    assert(this->test(i));
+    // The letters before i, which are the children before it
+    const auto before = bits_ & ((std::uint32_t{1} << i) - 1U);
+    return first_child_ +
+           static_cast<std::uint32_t>(__builtin_popcount(before));
+  }
+
+  /** @returns The number of children this node has */
+  std::uint32_t numb_children() const {
+    return static_cast<std::uint32_t>(__builtin_popcount(bits_ & letter_bits));
+  }
+
+  /** @returns True if any letters are present/child nodes of this one exist */
+  bool any() const { return (bits_ & letter_bits) != 0; }
+
+  bool is_end_of_word() const { return (bits_ & end_of_word_bit) != 0; }
+
+  std::uint32_t first_child() const { return first_child_; }
+
+  friend std::ostream& operator<<(std::ostream& os, const Node& node);
+
+private:
+  static constexpr std::uint32_t letter_bits = (std::uint32_t{1} << 26) - 1U;
+  static constexpr std::uint32_t end_of_word_bit = std::uint32_t{1} << 31;
+
+  /** Bit i is letter i, bit 31 is end of word */
+  std::uint32_t bits_ = 0;
+  std::uint32_t first_child_ = 0;
+};
+
+static_assert(sizeof(Node) == 8);
+
+} // namespace compact_trie3
+
+#endif // COMPACT_TRIE3_NODE_HPP
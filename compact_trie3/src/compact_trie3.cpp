@@ -0,0 +1,205 @@
+#include "wordsearch_solver/compact_trie3/compact_trie3.hpp"
+#include "wordsearch_solver/utility/utility.hpp"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace compact_trie3 {
+
+namespace {
+
+constexpr auto max_index = std::numeric_limits<std::uint32_t>::max();
+
+/** @returns The letter index of @p c, 0 for 'a', or 26 or more if it isn't a
+ * lowercase ascii letter
+ */
+std::uint32_t letter_index(const char c) {
+  return static_cast<std::uint32_t>(c - 'a');
+}
+
+} // namespace
+
+std::ostream& operator<<(std::ostream& os, const Node& node) {
+  std::string letters;
+  for (std::size_t i = 0; i < 26; ++i) {
+    if (node.test(i)) {
+      letters.push_back(static_cast<char>('a' + i));
+    }
+  }
+  return os << fmt::format("{{{}{}{}}}", letters,
+                           node.is_end_of_word() ? "|" : " ",
+                           node.first_child());
+}
+
+CompactTrie3::CompactTrie3() : nodes_(1), first_word_ids_(1, 0), size_(0) {}
+
+CompactTrie3::CompactTrie3(const std::initializer_list<std::string_view>& words)
+    : CompactTrie3(words.begin(), words.end()) {}
+
+CompactTrie3::CompactTrie3(const std::initializer_list<std::string>& words)
+    : CompactTrie3(words.begin(), words.end()) {}
+
+CompactTrie3::CompactTrie3(const std::initializer_list<const char*>& words)
+    : CompactTrie3(words.begin(), words.end()) {}
+
+void CompactTrie3::init(std::vector<std::string> words) {
+  for (const auto& word : words) {
+    utility::throw_if_not_lowercase_ascii(word);
+  }
+  std::sort(words.begin(), words.end());
+  words.erase(std::unique(words.begin(), words.end()), words.end());
+  if (words.size() >= max_index) {
+    throw std::length_error(
+        fmt::format("{} words is too many for a compact trie3", words.size()));
+  }
+
+  // A row at a time, each node in a row as the words with its prefix, which
+  // in sorted order are next to each other
+  using WordsIterator = std::vector<std::string>::const_iterator;
+  std::vector<std::pair<WordsIterator, WordsIterator>> row{
+      {words.cbegin(), words.cend()}};
+  std::vector<std::pair<WordsIterator, WordsIterator>> next_row;
+  nodes_.clear();
+  first_word_ids_.clear();
+  for (std::size_t depth = 0; !row.empty(); ++depth) {
+    // The next row's nodes start straight after this row's
+    auto next_index = nodes_.size() + row.size();
+    for (auto [first, last] : row) {
+      first_word_ids_.push_back(
+          static_cast<std::uint32_t>(std::distance(words.cbegin(), first)));
+      Node node{};
+      // Sorted, so if the prefix itself is a word it comes first
+      if (first != last && first->size() == depth) {
+        node.set_is_end_of_word(true);
+        ++first;
+      }
+      if (next_index >= max_index) {
+        throw std::length_error("Too many nodes for a compact trie3");
+      }
+      node.set_first_child(static_cast<std::uint32_t>(next_index));
+      while (first != last) {
+        const auto c = (*first)[depth];
+        const auto group_last =
+            std::find_if(first, last, [depth, c](const std::string& word) {
+              return word[depth] != c;
+            });
+        node.add_letter(letter_index(c));
+        next_row.emplace_back(first, group_last);
+        first = group_last;
+      }
+      next_index += node.numb_children();
+      nodes_.push_back(node);
+    }
+    row.swap(next_row);
+    next_row.clear();
+  }
+
+  size_ = words.size();
+  max_word_length_ = 0;
+  for (const auto& word : words) {
+    max_word_length_ = std::max(max_word_length_, word.size());
+  }
+  nodes_.shrink_to_fit();
+  first_word_ids_.shrink_to_fit();
+}
+
+std::optional<CompactTrie3::Cursor>
+CompactTrie3::search(const std::string_view word) const {
+  std::optional<Cursor> cursor = this->root();
+  for (auto it = word.begin(); cursor && it != word.end(); ++it) {
+    cursor = this->child(*cursor, *it);
+  }
+  return cursor;
+}
+
+bool CompactTrie3::contains(const std::string_view word) const {
+  const auto cursor = this->search(word);
+  return cursor && this->is_word(*cursor);
+}
+
+bool CompactTrie3::further(const std::string_view word) const {
+  const auto cursor = this->search(word);
+  return cursor && this->has_further(*cursor);
+}
+
+std::size_t CompactTrie3::size() const { return size_; }
+
+bool CompactTrie3::empty() const { return size_ == 0; }
+
+std::size_t CompactTrie3::max_word_length() const { return max_word_length_; }
+
+std::size_t CompactTrie3::data_size() const {
+  return nodes_.size() * sizeof(Node) +
+         first_word_ids_.size() * sizeof(std::uint32_t);
+}
+
+CompactTrie3::Cursor CompactTrie3::root() const { return Cursor{0}; }
+
+std::optional<CompactTrie3::Cursor>
+CompactTrie3::child(const Cursor cursor, const char c) const {
+  const auto& node = nodes_[cursor.index];
+  const auto i = letter_index(c);
+  if (i >= 26 || !node.test(i)) {
+    return {};
+  }
+  return Cursor{node.child(i)};
+}
+
+bool CompactTrie3::is_word(const Cursor cursor) const {
+  return nodes_[cursor.index].is_end_of_word();
+}
+
+bool CompactTrie3::has_further(const Cursor cursor) const {
+  return nodes_[cursor.index].any();
+}
+
+std::size_t CompactTrie3::word_id(const Cursor cursor) const {
+  assert(this->is_word(cursor));
+  return first_word_ids_[cursor.index];
+}
+
+std::string CompactTrie3::word(const std::size_t id) const {
+  if (id >= size_) {
+    throw std::out_of_range("Word id out of range of compact trie3");
+  }
+  std::string word;
+  std::uint32_t index = 0;
+  while (!(nodes_[index].is_end_of_word() && first_word_ids_[index] == id)) {
+    const auto& node = nodes_[index];
+    // Children are next to each other and in letter order, so id is under the
+    // last child whose first word id isn't greater than it
+    const auto first = first_word_ids_.begin() + node.first_child();
+    const auto last = first + node.numb_children();
+    const auto child_it = std::prev(std::upper_bound(first, last, id));
+    const auto child_index =
+        static_cast<std::uint32_t>(child_it - first_word_ids_.begin());
+    std::size_t i = 0;
+    while (!node.test(i) || node.child(i) != child_index) {
+      ++i;
+    }
+    word.push_back(static_cast<char>('a' + i));
+    index = child_index;
+  }
+  return word;
+}
+
+std::ostream& operator<<(std::ostream& os, const CompactTrie3& ct) {
+  return os << fmt::format("Compact trie3 of size: {} ({} nodes, {} bytes)",
+                           ct.size(), ct.nodes_.size(), ct.data_size());
+}
+
+} // namespace compact_trie3
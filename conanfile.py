@@ -19,6 +19,10 @@ class WordsearchsolverConan(ConanFile):
             "trie": [True, False],
             "compact_trie": [True, False],
             "compact_trie2": [True, False],
+            "compact_trie3": [True, False],
+            "double_array_trie": [True, False],
+            "dawg": [True, False],
+            "louds_trie": [True, False],
             "dictionary_std_set": [True, False],
             "dictionary_std_vector": [True, False],
             }
@@ -26,6 +30,10 @@ class WordsearchsolverConan(ConanFile):
             "trie": True,
             "compact_trie": True,
             "compact_trie2": True,
+            "compact_trie3": True,
+            "double_array_trie": True,
+            "dawg": True,
+            "louds_trie": True,
             "dictionary_std_set": True,
             "dictionary_std_vector": True,
             }
@@ -51,8 +59,9 @@ class WordsearchsolverConan(ConanFile):
             #  "llvm_small_vector/0.1",
             )
 
-    _dict_impls = ["trie", "compact_trie", "compact_trie2",
-            "dictionary_std_set", "dictionary_std_vector",
+    _dict_impls = ["trie", "compact_trie", "compact_trie2", "compact_trie3",
+            "double_array_trie", "dawg", "louds_trie", "dictionary_std_set",
+            "dictionary_std_vector",
             ]
 
     def export_sources(self):
@@ -0,0 +1,163 @@
+#ifndef DAWG_HPP
+#define DAWG_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/** namespace dawg */
+namespace dawg {
+
+/** Minimal directed acyclic word graph, a trie with its common suffixes merged
+ *
+ * In any of the tries, "-ing", "-ness" and so on have their own nodes under
+ * every stem they end, thousands of times over. Here any two nodes with the
+ * same words below them (and the same end of word flag) are one node, so
+ * each suffix is stored once, and the graph is the smallest one that spells
+ * out exactly the words in the dictionary.
+ *
+ * ```
+ * "tap", "taps", "top", "tops"
+ *
+ * trie:  t -> a -> p* -> s*        dawg:  t -> a -> p* -> s*
+ *         \                                \   ^
+ *          > o -> p* -> s*                  > o
+ * ```
+ *
+ * Built one word at a time from sorted words, as in Daciuk et al.
+ * "Incremental Construction of Minimal Acyclic Finite-State Automata". Once
+ * a word no longer shares a prefix with the next one, the nodes at the end
+ * of it can't change any more, so are swapped for an existing node with the
+ * same words below it if there is one. This never holds more than one word's
+ * worth of nodes that aren't yet minimal.
+ *
+ * The finished graph is laid out with nodes in breadth first order in one
+ * vector, and each node's edges next to each other in another, with their
+ * letters in a third, so finding a child is a search through at most a few
+ * contiguous bytes.
+ *
+ * Since a node can be reached by many prefixes, it can't store a word id.
+ * Instead each edge stores how many words sort before those under it, out of
+ * the words under its parent. The Cursor adds these up on the way down, giving
+ * the id at any word.
+ *
+ * Unlike the other tries, this works for any chars, not only lowercase ascii.
+ *
+ * Immutable once constructed, so safe to read from multiple threads at once.
+ */
+class Dawg {
+public:
+  /** @copydoc solver::SolverDictWrapper::Cursor */
+  struct Cursor {
+    /** The node's index */
+    std::uint32_t state;
+    /** The number of words that sort before the prefix spelt out so far */
+    std::uint32_t id;
+  };
+
+  Dawg();
+
+  Dawg(Dawg&&) = default;
+  Dawg& operator=(Dawg&&) = default;
+
+  Dawg(const Dawg&) = delete;
+  Dawg& operator=(const Dawg&) = delete;
+
+  Dawg(const std::initializer_list<std::string_view>& words);
+  Dawg(const std::initializer_list<std::string>& words);
+  Dawg(const std::initializer_list<const char*>& words);
+
+  template <class Iterator1, class Iterator2,
+            std::enable_if_t<!std::is_integral_v<Iterator2>, int> = 0>
+  Dawg(Iterator1 first, const Iterator2 last);
+
+  /** Constructs from any range of strings, in any order and with duplicates
+   *
+   * @throws std::length_error If there are more words or nodes than fit in
+   * 32 bits
+   */
+  template <class ForwardRange> explicit Dawg(const ForwardRange& words);
+
+  std::size_t size() const;
+
+  /** Size of underlying data store in bytes. */
+  std::size_t data_size() const;
+
+  bool empty() const;
+  /** @copydoc solver::SolverDictWrapper::max_word_length() */
+  std::size_t max_word_length() const;
+
+  /** @copydoc solver::SolverDictWrapper::contains() */
+  bool contains(const std::string_view word) const;
+
+  /** @copydoc solver::SolverDictWrapper::further() */
+  bool further(const std::string_view word) const;
+
+  /** @copydoc solver::SolverDictWrapper::contains_further() */
+  template <class OutputIterator>
+  void contains_further(const std::string_view stem,
+                        const std::string_view suffixes,
+                        OutputIterator contains_further_it) const;
+
+  /** @copydoc solver::SolverDictWrapper::root() */
+  Cursor root() const;
+  /** @copydoc solver::SolverDictWrapper::child() */
+  std::optional<Cursor> child(Cursor cursor, char c) const;
+  /** @copydoc solver::SolverDictWrapper::is_word() */
+  bool is_word(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::has_further() */
+  bool has_further(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::word_id() */
+  std::size_t word_id(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::word() */
+  std::string word(std::size_t id) const;
+
+  friend std::ostream& operator<<(std::ostream& os, const Dawg& dawg);
+
+private:
+  struct Node {
+    /** Index of this node's first edge, its others follow on from it */
+    std::uint32_t first_edge;
+    /** Up to one per possible char, so more than fits in a byte */
+    std::uint16_t numb_edges;
+    bool is_word;
+  };
+
+  struct Edge {
+    /** Index of the node this goes to */
+    std::uint32_t target;
+    /** How many of the parent's words sort before the target's */
+    std::uint32_t words_before;
+  };
+
+  /** Build from @p words, called by the templated constructors */
+  void init(std::vector<std::string> words);
+
+  /** Walk @p word from the root as far as it goes
+   *
+   * @returns The node at the end of @p word, or an empty `std::optional` if
+   * the dawg has no words starting with it
+   */
+  std::optional<Cursor> search(const std::string_view word) const;
+
+  std::vector<Node> nodes_;
+  /** For each edge, the letter it is for, apart from the rest of the edge so
+   * that searching a node's letters touches as few bytes as possible
+   */
+  std::vector<char> letters_;
+  std::vector<Edge> edges_;
+  std::size_t size_ = 0;
+  std::size_t max_word_length_ = 0;
+};
+
+} // namespace dawg
+
+#include "wordsearch_solver/dawg/dawg.tpp"
+
+#endif // DAWG_HPP
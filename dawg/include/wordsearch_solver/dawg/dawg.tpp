@@ -0,0 +1,37 @@
+#ifndef DAWG_TPP
+#define DAWG_TPP
+
+#include "wordsearch_solver/dawg/dawg.hpp"
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace dawg {
+
+template <class Iterator1, class Iterator2,
+          std::enable_if_t<!std::is_integral_v<Iterator2>, int>>
+Dawg::Dawg(Iterator1 first, const Iterator2 last) : Dawg() {
+  this->init(std::vector<std::string>(first, last));
+}
+
+template <class ForwardRange>
+Dawg::Dawg(const ForwardRange& words) : Dawg(words.begin(), words.end()) {}
+
+template <class OutputIterator>
+void Dawg::contains_further(const std::string_view stem,
+                            const std::string_view suffixes,
+                            OutputIterator contains_further_it) const {
+  const auto cursor = this->search(stem);
+  for (const auto c : suffixes) {
+    const auto child = cursor ? this->child(*cursor, c) : std::nullopt;
+    *contains_further_it++ = {child && this->is_word(*child),
+                              child && this->has_further(*child)};
+  }
+}
+
+} // namespace dawg
+
+#endif // DAWG_TPP
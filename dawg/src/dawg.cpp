@@ -0,0 +1,305 @@
+#include "wordsearch_solver/dawg/dawg.hpp"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace dawg {
+
+namespace {
+
+constexpr auto max_index = std::numeric_limits<std::uint32_t>::max();
+
+/** A node while building, before being laid out flat */
+struct BuildNode {
+  bool is_word = false;
+  /** In the order of the words, which for chars compared as by std::string is
+   * sorted
+   */
+  std::vector<std::pair<char, std::uint32_t>> edges;
+};
+
+/** Adds sorted words one at a time, keeping every node not on the path of the
+ * last word minimal
+ */
+class Builder {
+public:
+  Builder() : nodes_(1) {}
+
+  /** @param[in] word Must sort after every word added before it */
+  void add(const std::string_view word) {
+    assert(nodes_.size() == 1 || previous_ < word);
+    const auto mismatch =
+        std::mismatch(word.begin(), word.end(), previous_.begin(),
+                      previous_.end());
+    const auto prefix =
+        static_cast<std::size_t>(std::distance(word.begin(), mismatch.first));
+    // Nothing after the common prefix on the last word's path can change now
+    this->minimise(prefix);
+
+    auto state = unchecked_.empty() ? 0 : unchecked_.back().child;
+    for (auto it = mismatch.first; it != word.end(); ++it) {
+      const auto child = this->new_node();
+      nodes_[state].edges.emplace_back(*it, child);
+      unchecked_.push_back({state, child});
+      state = child;
+    }
+    nodes_[state].is_word = true;
+    previous_ = word;
+  }
+
+  /** Minimise what's left and hand over the nodes. Some are unused, having
+   * been merged, only those reachable from the root (node 0) are the dawg.
+   */
+  std::vector<BuildNode> finish() {
+    this->minimise(0);
+    return std::move(nodes_);
+  }
+
+private:
+  struct Unchecked {
+    std::uint32_t parent;
+    std::uint32_t child;
+  };
+
+  /** Nodes are keyed by their end of word flag and edges, as bytes. Children
+   * are minimised before their parents, so two nodes with the same words below
+   * them have exactly the same edges.
+   */
+  static std::string signature(const BuildNode& node) {
+    std::string key(1, node.is_word ? '1' : '0');
+    for (const auto& [c, target] : node.edges) {
+      key.push_back(c);
+      key.append(reinterpret_cast<const char*>(&target), sizeof(target));
+    }
+    return key;
+  }
+
+  /** Swap the unchecked nodes deeper than @p depth for their equivalents
+   * already in the dawg, or add them if there aren't any
+   */
+  void minimise(const std::size_t depth) {
+    while (unchecked_.size() > depth) {
+      const auto [parent, child] = unchecked_.back();
+      unchecked_.pop_back();
+      const auto [it, inserted] =
+          register_.try_emplace(signature(nodes_[child]), child);
+      if (!inserted) {
+        nodes_[parent].edges.back().second = it->second;
+        nodes_[child] = BuildNode{};
+        free_.push_back(child);
+      }
+    }
+  }
+
+  /** Reuses a node merged away, so only as many nodes as end up in the dawg,
+   * plus one word's worth, are ever held
+   */
+  std::uint32_t new_node() {
+    if (!free_.empty()) {
+      const auto node = free_.back();
+      free_.pop_back();
+      return node;
+    }
+    if (nodes_.size() >= max_index) {
+      throw std::length_error("Too many nodes for a dawg");
+    }
+    nodes_.emplace_back();
+    return static_cast<std::uint32_t>(nodes_.size() - 1);
+  }
+
+  std::vector<BuildNode> nodes_;
+  std::vector<Unchecked> unchecked_;
+  std::unordered_map<std::string, std::uint32_t> register_;
+  std::vector<std::uint32_t> free_;
+  std::string previous_;
+};
+
+/** @returns The number of words under @p node, including itself
+ *
+ * @param[in,out] counts The count for each node, max_index until worked out
+ */
+std::uint32_t count_words(const std::vector<BuildNode>& nodes,
+                          const std::uint32_t node,
+                          std::vector<std::uint32_t>& counts) {
+  if (counts[node] == max_index) {
+    std::uint32_t count = nodes[node].is_word;
+    for (const auto& [c, target] : nodes[node].edges) {
+      count += count_words(nodes, target, counts);
+    }
+    counts[node] = count;
+  }
+  return counts[node];
+}
+
+} // namespace
+
+Dawg::Dawg() : nodes_{Node{0, 0, false}} {}
+
+Dawg::Dawg(const std::initializer_list<std::string_view>& words)
+    : Dawg(words.begin(), words.end()) {}
+
+Dawg::Dawg(const std::initializer_list<std::string>& words)
+    : Dawg(words.begin(), words.end()) {}
+
+Dawg::Dawg(const std::initializer_list<const char*>& words)
+    : Dawg(words.begin(), words.end()) {}
+
+void Dawg::init(std::vector<std::string> words) {
+  std::sort(words.begin(), words.end());
+  words.erase(std::unique(words.begin(), words.end()), words.end());
+  if (words.size() >= max_index) {
+    throw std::length_error(
+        fmt::format("{} words is too many for a dawg", words.size()));
+  }
+
+  Builder builder;
+  for (const auto& word : words) {
+    builder.add(word);
+  }
+  const auto build_nodes = builder.finish();
+
+  std::vector<std::uint32_t> counts(build_nodes.size(), max_index);
+  size_ = count_words(build_nodes, 0, counts);
+  max_word_length_ = 0;
+  for (const auto& word : words) {
+    max_word_length_ = std::max(max_word_length_, word.size());
+  }
+  assert(size_ == words.size());
+
+  // Lay out breadth first from the root, so nodes near the root (which are
+  // visited far more often) are near each other
+  constexpr auto unplaced = max_index;
+  std::vector<std::uint32_t> placed(build_nodes.size(), unplaced);
+  std::vector<std::uint32_t> order{0};
+  placed[0] = 0;
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    for (const auto& [c, target] : build_nodes[order[i]].edges) {
+      if (placed[target] == unplaced) {
+        placed[target] = static_cast<std::uint32_t>(order.size());
+        order.push_back(target);
+      }
+    }
+  }
+
+  nodes_.clear();
+  nodes_.reserve(order.size());
+  for (const auto old : order) {
+    const auto& build_node = build_nodes[old];
+    if (letters_.size() + build_node.edges.size() >= max_index) {
+      throw std::length_error("Too many edges for a dawg");
+    }
+    nodes_.push_back(Node{static_cast<std::uint32_t>(letters_.size()),
+                          static_cast<std::uint16_t>(build_node.edges.size()),
+                          build_node.is_word});
+    std::uint32_t words_before = build_node.is_word;
+    for (const auto& [c, target] : build_node.edges) {
+      letters_.push_back(c);
+      edges_.push_back(Edge{placed[target], words_before});
+      words_before += counts[target];
+    }
+  }
+}
+
+std::size_t Dawg::size() const { return size_; }
+
+std::size_t Dawg::data_size() const {
+  return nodes_.size() * sizeof(Node) + letters_.size() * sizeof(char) +
+         edges_.size() * sizeof(Edge);
+}
+
+bool Dawg::empty() const { return this->size() == 0; }
+
+std::size_t Dawg::max_word_length() const { return max_word_length_; }
+
+std::optional<Dawg::Cursor> Dawg::search(const std::string_view word) const {
+  std::optional<Cursor> cursor = this->root();
+  for (auto it = word.begin(); cursor && it != word.end(); ++it) {
+    cursor = this->child(*cursor, *it);
+  }
+  return cursor;
+}
+
+bool Dawg::contains(const std::string_view word) const {
+  const auto cursor = this->search(word);
+  return cursor && this->is_word(*cursor);
+}
+
+bool Dawg::further(const std::string_view word) const {
+  const auto cursor = this->search(word);
+  return cursor && this->has_further(*cursor);
+}
+
+Dawg::Cursor Dawg::root() const { return Cursor{0, 0}; }
+
+std::optional<Dawg::Cursor> Dawg::child(const Cursor cursor,
+                                        const char c) const {
+  const auto& node = nodes_[cursor.state];
+  const auto first = letters_.begin() + node.first_edge;
+  const auto last = first + node.numb_edges;
+  const auto it = std::find(first, last, c);
+  if (it == last) {
+    return {};
+  }
+  const auto& edge = edges_[static_cast<std::size_t>(it - letters_.begin())];
+  return Cursor{edge.target, cursor.id + edge.words_before};
+}
+
+bool Dawg::is_word(const Cursor cursor) const {
+  return nodes_[cursor.state].is_word;
+}
+
+bool Dawg::has_further(const Cursor cursor) const {
+  return nodes_[cursor.state].numb_edges != 0;
+}
+
+std::size_t Dawg::word_id(const Cursor cursor) const {
+  assert(this->is_word(cursor));
+  return cursor.id;
+}
+
+std::string Dawg::word(const std::size_t id) const {
+  if (id >= size_) {
+    throw std::out_of_range("Word id out of range of dawg");
+  }
+  std::string word;
+  std::uint32_t state = 0;
+  // How many of the words under state sort before the one we're after
+  auto remaining = static_cast<std::uint32_t>(id);
+  while (!(nodes_[state].is_word && remaining == 0)) {
+    // The word is under the last edge with no more words before it than that
+    const auto& node = nodes_[state];
+    const auto first = edges_.begin() + node.first_edge;
+    const auto last = first + node.numb_edges;
+    const auto it = std::prev(std::upper_bound(
+        first, last, remaining, [](const auto value, const Edge& edge) {
+          return value < edge.words_before;
+        }));
+    remaining -= it->words_before;
+    word.push_back(letters_[static_cast<std::size_t>(it - edges_.begin())]);
+    state = it->target;
+  }
+  return word;
+}
+
+std::ostream& operator<<(std::ostream& os, const Dawg& dawg) {
+  return os << fmt::format("Dawg of size: {} ({} nodes, {} edges, {} bytes)",
+                           dawg.size(), dawg.nodes_.size(),
+                           dawg.edges_.size(), dawg.data_size());
+}
+
+} // namespace dawg
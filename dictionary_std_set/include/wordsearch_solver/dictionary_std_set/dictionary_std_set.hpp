@@ -4,10 +4,12 @@
 #include <cstddef>
 #include <functional>
 #include <initializer_list>
+#include <optional>
 #include <ostream>
 #include <set>
 #include <string>
 #include <string_view>
+#include <vector>
 
 /** namespace dictionary_std_set */
 namespace dictionary_std_set {
@@ -19,6 +21,16 @@ namespace dictionary_std_set {
  */
 class DictionaryStdSet {
 public:
+  /** @copydoc solver::SolverDictWrapper::Cursor
+   *
+   * The first word starting with the cursor's prefix, which is the first
+   * @p depth letters of it.
+   */
+  struct Cursor {
+    std::set<std::string, std::less<void>>::const_iterator first;
+    std::size_t depth;
+  };
+
   DictionaryStdSet() = default;
 
   DictionaryStdSet(DictionaryStdSet&&) = default;
@@ -60,6 +72,8 @@ public:
 
   std::size_t size() const;
   bool empty() const;
+  /** @copydoc solver::SolverDictWrapper::max_word_length() */
+  std::size_t max_word_length() const;
 
   /** @copydoc solver::SolverDictWrapper::contains_further() */
   template <class OutputIndexIterator>
@@ -72,6 +86,23 @@ public:
   /** @copydoc solver::SolverDictWrapper::further() */
   bool further(const std::string_view word) const;
 
+  /** @copydoc solver::SolverDictWrapper::root() */
+  Cursor root() const;
+  /** @copydoc solver::SolverDictWrapper::child() */
+  std::optional<Cursor> child(Cursor cursor, char c) const;
+  /** @copydoc solver::SolverDictWrapper::is_word() */
+  bool is_word(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::has_further() */
+  bool has_further(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::word_id()
+   *
+   * @note `std::set` can't tell an element's position without walking to it,
+   * so this binary searches a sorted array of the words instead, O(log(n)).
+   */
+  std::size_t word_id(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::word() */
+  std::string word(std::size_t id) const;
+
   friend std::ostream& operator<<(std::ostream&, const DictionaryStdSet&);
 
 private:
@@ -82,6 +113,9 @@ private:
    * specialisation
    */
   std::set<std::string, std::less<void>> dict_;
+  /** The words of dict_ in order, so that a word's id is its index */
+  std::vector<const std::string*> words_;
+  std::size_t max_word_length_ = 0;
 };
 
 } // namespace dictionary_std_set
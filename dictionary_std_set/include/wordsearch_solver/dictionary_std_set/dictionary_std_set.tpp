@@ -11,6 +11,7 @@
 #include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace dictionary_std_set {
 
@@ -30,6 +31,11 @@ DictionaryStdSet::DictionaryStdSet(Iterator1 first, const Iterator2 last)
   for (; first != last; ++first) {
     dict_.insert(std::string{*first});
   }
+  words_.reserve(dict_.size());
+  for (const auto& word : dict_) {
+    max_word_length_ = std::max(max_word_length_, word.size());
+    words_.push_back(&word);
+  }
 }
 
 // Actual cons that does the work
@@ -40,7 +46,13 @@ template <
                         std::string_view>,
         int>>
 DictionaryStdSet::DictionaryStdSet(Iterator1 first, const Iterator2 last)
-    : dict_(first, last) {}
+    : dict_(first, last) {
+  words_.reserve(dict_.size());
+  for (const auto& word : dict_) {
+    max_word_length_ = std::max(max_word_length_, word.size());
+    words_.push_back(&word);
+  }
+}
 
 template <class OutputIndexIterator>
 void DictionaryStdSet::contains_further(const std::string_view stem,
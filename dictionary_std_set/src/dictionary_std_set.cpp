@@ -10,10 +10,14 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <iterator>
+#include <optional>
 #include <ostream>
 #include <set>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace dictionary_std_set {
 
@@ -36,6 +40,10 @@ std::size_t DictionaryStdSet::size() const { return dict_.size(); }
 
 bool DictionaryStdSet::empty() const { return dict_.empty(); }
 
+std::size_t DictionaryStdSet::max_word_length() const {
+  return max_word_length_;
+}
+
 bool DictionaryStdSet::contains(const std::string_view word) const {
   return dict_.find(word) != dict_.end();
   // return std::binary_search(dict_.begin(), dict_.end(), key);
@@ -57,6 +65,58 @@ bool DictionaryStdSet::further(const std::string_view prefix) const {
           static_cast<decltype(prefix)::difference_type>(prefix.size()));
 }
 
+DictionaryStdSet::Cursor DictionaryStdSet::root() const {
+  return {dict_.begin(), 0};
+}
+
+std::optional<DictionaryStdSet::Cursor>
+DictionaryStdSet::child(const Cursor cursor, const char c) const {
+  if (cursor.first == dict_.end()) {
+    return {};
+  }
+  std::string prefix{cursor.first->data(), cursor.depth};
+  prefix.push_back(c);
+  const auto it = dict_.lower_bound(prefix);
+  if (it == dict_.end() || it->compare(0, prefix.size(), prefix) != 0) {
+    return {};
+  }
+  return Cursor{it, cursor.depth + 1};
+}
+
+bool DictionaryStdSet::is_word(const Cursor cursor) const {
+  return cursor.first != dict_.end() && cursor.first->size() == cursor.depth;
+}
+
+bool DictionaryStdSet::has_further(const Cursor cursor) const {
+  if (cursor.first == dict_.end()) {
+    return false;
+  }
+  if (cursor.first->size() > cursor.depth) {
+    return true;
+  }
+  const auto next = std::next(cursor.first);
+  return next != dict_.end() &&
+         next->compare(0, cursor.depth, *cursor.first, 0, cursor.depth) == 0;
+}
+
+std::size_t DictionaryStdSet::word_id(const Cursor cursor) const {
+  assert(this->is_word(cursor));
+  const auto it = std::lower_bound(
+      words_.begin(), words_.end(), *cursor.first,
+      [](const std::string* const word, const std::string& value) {
+        return *word < value;
+      });
+  assert(it != words_.end() && *it == &*cursor.first);
+  return static_cast<std::size_t>(std::distance(words_.begin(), it));
+}
+
+std::string DictionaryStdSet::word(const std::size_t id) const {
+  if (id >= words_.size()) {
+    throw std::out_of_range("Word id out of range of dictionary");
+  }
+  return *words_[id];
+}
+
 std::ostream& operator<<(std::ostream& os, const DictionaryStdSet& dsv) {
   return os << fmt::format("{}", dsv.dict_);
 }
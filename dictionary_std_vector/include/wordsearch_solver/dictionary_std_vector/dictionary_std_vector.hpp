@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <initializer_list>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <string_view>
@@ -24,6 +25,17 @@ namespace dictionary_std_vector {
  */
 class DictionaryStdVector {
 public:
+  /** @copydoc solver::SolverDictWrapper::Cursor
+   *
+   * The range of words starting with the cursor's prefix, which is the first
+   * @p depth letters of any of them.
+   */
+  struct Cursor {
+    std::vector<std::string>::const_iterator first;
+    std::vector<std::string>::const_iterator last;
+    std::size_t depth;
+  };
+
   DictionaryStdVector() = default;
   // DictionaryStdVector(const std::vector<std::string>& dict);
 
@@ -48,6 +60,8 @@ public:
 
   std::size_t size() const;
   bool empty() const;
+  /** @copydoc solver::SolverDictWrapper::max_word_length() */
+  std::size_t max_word_length() const;
 
   /** @copydoc solver::SolverDictWrapper::contains_further() */
   template <class OutputIndexIterator>
@@ -60,6 +74,22 @@ public:
   /** @copydoc solver::SolverDictWrapper::further() */
   bool further(const std::string_view word) const;
 
+  /** @copydoc solver::SolverDictWrapper::root() */
+  Cursor root() const;
+  /** @copydoc solver::SolverDictWrapper::child() */
+  std::optional<Cursor> child(Cursor cursor, char c) const;
+  /** @copydoc solver::SolverDictWrapper::is_word() */
+  bool is_word(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::has_further() */
+  bool has_further(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::word_id()
+   *
+   * This is the word's position in the sorted vector.
+   */
+  std::size_t word_id(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::word() */
+  std::string word(std::size_t id) const;
+
   friend std::ostream& operator<<(std::ostream&, const DictionaryStdVector&);
 
 private:
@@ -68,6 +98,7 @@ private:
                     Iterator last) const;
 
   std::vector<std::string> dict_;
+  std::size_t max_word_length_ = 0;
 };
 
 } // namespace dictionary_std_vector
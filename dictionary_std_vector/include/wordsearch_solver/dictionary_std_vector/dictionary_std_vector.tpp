@@ -22,6 +22,9 @@ DictionaryStdVector::DictionaryStdVector(Iterator1 first, const Iterator2 last)
     : dict_(first, last) {
   std::sort(dict_.begin(), dict_.end());
   dict_.erase(std::unique(dict_.begin(), dict_.end()), dict_.end());
+  for (const auto& word : dict_) {
+    max_word_length_ = std::max(max_word_length_, word.size());
+  }
 }
 
 template <class ForwardRange>
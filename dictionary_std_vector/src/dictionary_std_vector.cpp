@@ -10,6 +10,8 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <iterator>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <string_view>
@@ -37,6 +39,10 @@ std::size_t DictionaryStdVector::size() const { return dict_.size(); }
 
 bool DictionaryStdVector::empty() const { return dict_.empty(); }
 
+std::size_t DictionaryStdVector::max_word_length() const {
+  return max_word_length_;
+}
+
 bool DictionaryStdVector::contains(const std::string_view word) const {
   return std::binary_search(dict_.begin(), dict_.end(), word);
 }
@@ -63,6 +69,49 @@ bool DictionaryStdVector::further_impl(const std::string_view prefix,
           static_cast<decltype(prefix)::difference_type>(prefix.size()));
 }
 
+DictionaryStdVector::Cursor DictionaryStdVector::root() const {
+  return {dict_.begin(), dict_.end(), 0};
+}
+
+std::optional<DictionaryStdVector::Cursor>
+DictionaryStdVector::child(const Cursor cursor, const char c) const {
+  // The words in the cursor's range are sorted and share their first depth
+  // letters, so those with c next are contiguous. If the prefix itself is a
+  // word, it comes first.
+  using Traits = std::string::traits_type;
+  const auto depth = cursor.depth;
+  const auto first = std::partition_point(
+      cursor.first, cursor.last, [depth, c](const std::string& word) {
+        return word.size() <= depth || Traits::lt(word[depth], c);
+      });
+  const auto last = std::partition_point(
+      first, cursor.last,
+      [depth, c](const std::string& word) { return word[depth] == c; });
+  if (first == last) {
+    return {};
+  }
+  return Cursor{first, last, depth + 1};
+}
+
+bool DictionaryStdVector::is_word(const Cursor cursor) const {
+  return cursor.first != cursor.last && cursor.first->size() == cursor.depth;
+}
+
+bool DictionaryStdVector::has_further(const Cursor cursor) const {
+  return cursor.first != cursor.last &&
+         (cursor.first->size() > cursor.depth ||
+          std::next(cursor.first) != cursor.last);
+}
+
+std::size_t DictionaryStdVector::word_id(const Cursor cursor) const {
+  assert(this->is_word(cursor));
+  return static_cast<std::size_t>(std::distance(dict_.begin(), cursor.first));
+}
+
+std::string DictionaryStdVector::word(const std::size_t id) const {
+  return dict_.at(id);
+}
+
 std::ostream& operator<<(std::ostream& os, const DictionaryStdVector& dsv) {
   return os << fmt::format("{}", dsv.dict_);
 }
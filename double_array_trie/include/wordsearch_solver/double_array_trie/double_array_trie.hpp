@@ -0,0 +1,167 @@
+#ifndef DOUBLE_ARRAY_TRIE_HPP
+#define DOUBLE_ARRAY_TRIE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <ostream>
+#include <set>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/** namespace double_array_trie */
+namespace double_array_trie {
+
+/** Trie with every node in one flat array, where each child lookup is a
+ * single array access.
+ *
+ * Each node is a slot in the array, holding a BASE and a CHECK. The child of
+ * node `s` for the letter with code `c` (1 for 'a' to 26 for 'z') is always
+ * in slot `t = BASE[s] + c`, and is there only if `CHECK[t] == s`. Each
+ * node's BASE is picked when building so that all of its children's slots
+ * are free, packing the children of different nodes in between each other.
+ *
+ * The compact_trie needs a popcount and the count of nodes before it on its
+ * row to find a child, and the compact_trie2 a linear search through the
+ * node's letters. Here it is the same add and compare for every letter.
+ *
+ * ```
+ * Node s with children 'a' (code 1) and 'c' (code 3), with BASE[s] = 4
+ *
+ * slot    4    5    6    7    8
+ * CHECK |    || s  ||    || s  ||    |
+ *              'a'        'c'
+ * ```
+ *
+ * Each slot is 8 bytes, with the node's end of word flag in the top bit of
+ * BASE, plus 4 bytes for the id of the first word under it. Slots that are
+ * not nodes are left free, though the test dictionary leaves under 0.1% of
+ * them free.
+ *
+ * NOTE: this only works for lowercase ascii.
+ *
+ * Immutable once constructed, so safe to read from multiple threads at once.
+ */
+class DoubleArrayTrie {
+public:
+  /** @copydoc solver::SolverDictWrapper::Cursor */
+  struct Cursor {
+    /** The node's slot */
+    std::uint32_t state;
+  };
+
+  DoubleArrayTrie();
+
+  DoubleArrayTrie(DoubleArrayTrie&&) = default;
+  DoubleArrayTrie& operator=(DoubleArrayTrie&&) = default;
+
+  DoubleArrayTrie(const DoubleArrayTrie&) = delete;
+  DoubleArrayTrie& operator=(const DoubleArrayTrie&) = delete;
+
+  DoubleArrayTrie(const std::initializer_list<std::string_view>& words);
+  DoubleArrayTrie(const std::initializer_list<std::string>& words);
+  DoubleArrayTrie(const std::initializer_list<const char*>& words);
+
+  template <class Iterator1, class Iterator2,
+            std::enable_if_t<!std::is_integral_v<Iterator2>, int> = 0>
+  DoubleArrayTrie(Iterator1 first, const Iterator2 last);
+
+  /** Constructs from any range of strings, in any order and with duplicates
+   *
+   * @throws std::runtime_error If a word is not all lowercase ascii
+   */
+  template <class ForwardRange>
+  explicit DoubleArrayTrie(const ForwardRange& words);
+
+  std::size_t size() const;
+
+  /** Size of underlying data store in bytes. */
+  std::size_t data_size() const;
+
+  bool empty() const;
+  /** @copydoc solver::SolverDictWrapper::max_word_length() */
+  std::size_t max_word_length() const;
+
+  /** @copydoc solver::SolverDictWrapper::contains() */
+  bool contains(const std::string_view word) const;
+
+  /** @copydoc solver::SolverDictWrapper::further() */
+  bool further(const std::string_view word) const;
+
+  /** @copydoc solver::SolverDictWrapper::contains_further() */
+  template <class OutputIterator>
+  void contains_further(const std::string_view stem,
+                        const std::string_view suffixes,
+                        OutputIterator contains_further_it) const;
+
+  /** @copydoc solver::SolverDictWrapper::root() */
+  Cursor root() const;
+  /** @copydoc solver::SolverDictWrapper::child() */
+  std::optional<Cursor> child(Cursor cursor, char c) const;
+  /** @copydoc solver::SolverDictWrapper::is_word() */
+  bool is_word(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::has_further() */
+  bool has_further(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::word_id() */
+  std::size_t word_id(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::word() */
+  std::string word(std::size_t id) const;
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const DoubleArrayTrie& dat);
+
+private:
+  struct Unit {
+    /** Children are at `base + code`, 0 if there are none. The top bit is set
+     * if this node is the end of a word.
+     */
+    std::uint32_t base;
+    /** The parent's slot, or free_slot if this slot isn't a node */
+    std::uint32_t check;
+  };
+
+  /** Build from @p words, called by the templated constructors */
+  void init(std::vector<std::string> words);
+
+  /** Add the node in @p state for the words in `[first, last)`, which share
+   * their first @p depth letters, and then all the nodes under it
+   */
+  void build(std::uint32_t state,
+             std::vector<std::string>::const_iterator first,
+             std::vector<std::string>::const_iterator last, std::size_t depth,
+             std::set<std::uint32_t>& free_slots);
+
+  /** Find a BASE for which the slots of every code in @p codes are free,
+   * growing the array to fit it
+   *
+   * @param[in,out] free_slots Every free slot, kept up to date as the array
+   * grows. Only these are tried for the first child, rather than walking
+   * the mostly full array.
+   */
+  std::uint32_t find_base(const std::vector<std::uint32_t>& codes,
+                          std::set<std::uint32_t>& free_slots);
+
+  /** Walk @p word from the root as far as it goes
+   *
+   * @returns The node at the end of @p word, or an empty `std::optional` if
+   * the trie has no words starting with it
+   */
+  std::optional<Cursor> search(const std::string_view word) const;
+
+  std::vector<Unit> units_;
+  /** For each slot that's a node, the id of the first word under it, in
+   * sorted order. For a word, this is its own id.
+   */
+  std::vector<std::uint32_t> first_word_ids_;
+  std::size_t size_ = 0;
+  std::size_t max_word_length_ = 0;
+};
+
+} // namespace double_array_trie
+
+#include "wordsearch_solver/double_array_trie/double_array_trie.tpp"
+
+#endif // DOUBLE_ARRAY_TRIE_HPP
@@ -0,0 +1,39 @@
+#ifndef DOUBLE_ARRAY_TRIE_TPP
+#define DOUBLE_ARRAY_TRIE_TPP
+
+#include "wordsearch_solver/double_array_trie/double_array_trie.hpp"
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace double_array_trie {
+
+template <class Iterator1, class Iterator2,
+          std::enable_if_t<!std::is_integral_v<Iterator2>, int>>
+DoubleArrayTrie::DoubleArrayTrie(Iterator1 first, const Iterator2 last)
+    : DoubleArrayTrie() {
+  this->init(std::vector<std::string>(first, last));
+}
+
+template <class ForwardRange>
+DoubleArrayTrie::DoubleArrayTrie(const ForwardRange& words)
+    : DoubleArrayTrie(words.begin(), words.end()) {}
+
+template <class OutputIterator>
+void DoubleArrayTrie::contains_further(
+    const std::string_view stem, const std::string_view suffixes,
+    OutputIterator contains_further_it) const {
+  const auto cursor = this->search(stem);
+  for (const auto c : suffixes) {
+    const auto child = cursor ? this->child(*cursor, c) : std::nullopt;
+    *contains_further_it++ = {child && this->is_word(*child),
+                              child && this->has_further(*child)};
+  }
+}
+
+} // namespace double_array_trie
+
+#endif // DOUBLE_ARRAY_TRIE_TPP
@@ -0,0 +1,266 @@
+#include "wordsearch_solver/double_array_trie/double_array_trie.hpp"
+
+#include "wordsearch_solver/utility/utility.hpp"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace double_array_trie {
+
+namespace {
+
+constexpr std::uint32_t word_bit = std::uint32_t{1} << 31;
+constexpr std::uint32_t base_mask = word_bit - 1;
+constexpr std::uint32_t free_slot = std::numeric_limits<std::uint32_t>::max();
+/** Codes go from 1 for 'a' to this for 'z' */
+constexpr std::uint32_t numb_codes = 26;
+
+/** @returns The code of @p c, or 0 if it isn't a lowercase ascii letter */
+std::uint32_t code(const char c) {
+  const auto code = static_cast<std::uint32_t>(c - 'a') + 1;
+  return code <= numb_codes ? code : 0;
+}
+
+} // namespace
+
+// The root is in slot 0, with room after it for base 0, see child()
+DoubleArrayTrie::DoubleArrayTrie()
+    : units_(numb_codes + 1, Unit{0, free_slot}),
+      first_word_ids_(units_.size(), 0), size_(0) {
+  units_[0].check = 0;
+}
+
+DoubleArrayTrie::DoubleArrayTrie(
+    const std::initializer_list<std::string_view>& words)
+    : DoubleArrayTrie(words.begin(), words.end()) {}
+
+DoubleArrayTrie::DoubleArrayTrie(
+    const std::initializer_list<std::string>& words)
+    : DoubleArrayTrie(words.begin(), words.end()) {}
+
+DoubleArrayTrie::DoubleArrayTrie(
+    const std::initializer_list<const char*>& words)
+    : DoubleArrayTrie(words.begin(), words.end()) {}
+
+void DoubleArrayTrie::init(std::vector<std::string> words) {
+  for (const auto& word : words) {
+    utility::throw_if_not_lowercase_ascii(word);
+  }
+  std::sort(words.begin(), words.end());
+  words.erase(std::unique(words.begin(), words.end()), words.end());
+  if (words.size() > base_mask) {
+    throw std::length_error(
+        fmt::format("{} words is too many for a double array trie",
+                    words.size()));
+  }
+
+  size_ = 0;
+  max_word_length_ = 0;
+  for (const auto& word : words) {
+    max_word_length_ = std::max(max_word_length_, word.size());
+  }
+  std::set<std::uint32_t> free_slots;
+  for (std::uint32_t slot = 1; slot < units_.size(); ++slot) {
+    free_slots.insert(slot);
+  }
+  this->build(0, words.begin(), words.end(), 0, free_slots);
+  assert(size_ == words.size());
+  units_.shrink_to_fit();
+  first_word_ids_.shrink_to_fit();
+}
+
+void DoubleArrayTrie::build(const std::uint32_t state,
+                            std::vector<std::string>::const_iterator first,
+                            const std::vector<std::string>::const_iterator last,
+                            const std::size_t depth,
+                            std::set<std::uint32_t>& free_slots) {
+  // Sorted, so if the prefix itself is a word it comes first
+  const bool is_word = first != last && first->size() == depth;
+  first_word_ids_[state] = static_cast<std::uint32_t>(size_);
+  if (is_word) {
+    ++first;
+    ++size_;
+  }
+  if (first == last) {
+    units_[state].base = is_word ? word_bit : 0;
+    return;
+  }
+
+  // Words with the same next letter are next to each other
+  std::vector<std::uint32_t> codes;
+  std::vector<std::vector<std::string>::const_iterator> group_firsts;
+  for (auto it = first; it != last; ++it) {
+    const auto c = code((*it)[depth]);
+    if (codes.empty() || codes.back() != c) {
+      codes.push_back(c);
+      group_firsts.push_back(it);
+    }
+  }
+  group_firsts.push_back(last);
+
+  const auto base = this->find_base(codes, free_slots);
+  units_[state].base = base | (is_word ? word_bit : 0);
+  for (const auto c : codes) {
+    units_[base + c].check = state;
+    free_slots.erase(base + c);
+  }
+  for (std::size_t i = 0; i < codes.size(); ++i) {
+    this->build(base + codes[i], group_firsts[i], group_firsts[i + 1],
+                depth + 1, free_slots);
+  }
+}
+
+std::uint32_t
+DoubleArrayTrie::find_base(const std::vector<std::uint32_t>& codes,
+                           std::set<std::uint32_t>& free_slots) {
+  assert(!codes.empty());
+  const auto is_free = [this](const std::size_t slot) {
+    return slot >= units_.size() || units_[slot].check == free_slot;
+  };
+
+  // Try each free slot in turn for the first child, base is at least 1 so
+  // that no child is ever in the root's slot. Past the end of the array
+  // every slot is free, so that always fits.
+  std::size_t slot = std::max<std::size_t>(units_.size(), codes.front() + 1);
+  for (auto it = free_slots.lower_bound(codes.front() + 1);
+       it != free_slots.end(); ++it) {
+    const auto base = *it - codes.front();
+    if (std::all_of(codes.begin(), codes.end(),
+                    [&](const auto c) { return is_free(base + c); })) {
+      slot = *it;
+      break;
+    }
+  }
+  const auto base = slot - codes.front();
+  if (base + numb_codes >= base_mask) {
+    throw std::length_error("Double array trie too big");
+  }
+
+  // Room for every code after base, so that child() never needs to check
+  // whether it's off the end
+  if (units_.size() <= base + numb_codes) {
+    const auto old_size = units_.size();
+    units_.resize(base + numb_codes + 1, Unit{0, free_slot});
+    first_word_ids_.resize(units_.size(), 0);
+    for (auto new_slot = old_size; new_slot < units_.size(); ++new_slot) {
+      free_slots.insert(free_slots.end(),
+                        static_cast<std::uint32_t>(new_slot));
+    }
+  }
+  return static_cast<std::uint32_t>(base);
+}
+
+std::size_t DoubleArrayTrie::size() const { return size_; }
+
+std::size_t DoubleArrayTrie::data_size() const {
+  return units_.size() * sizeof(Unit) +
+         first_word_ids_.size() * sizeof(std::uint32_t);
+}
+
+bool DoubleArrayTrie::empty() const { return this->size() == 0; }
+
+std::size_t DoubleArrayTrie::max_word_length() const {
+  return max_word_length_;
+}
+
+std::optional<DoubleArrayTrie::Cursor>
+DoubleArrayTrie::search(const std::string_view word) const {
+  std::optional<Cursor> cursor = this->root();
+  for (auto it = word.begin(); cursor && it != word.end(); ++it) {
+    cursor = this->child(*cursor, *it);
+  }
+  return cursor;
+}
+
+bool DoubleArrayTrie::contains(const std::string_view word) const {
+  const auto cursor = this->search(word);
+  return cursor && this->is_word(*cursor);
+}
+
+bool DoubleArrayTrie::further(const std::string_view word) const {
+  const auto cursor = this->search(word);
+  return cursor && this->has_further(*cursor);
+}
+
+DoubleArrayTrie::Cursor DoubleArrayTrie::root() const { return Cursor{0}; }
+
+std::optional<DoubleArrayTrie::Cursor>
+DoubleArrayTrie::child(const Cursor cursor, const char c) const {
+  const auto base = units_[cursor.state].base & base_mask;
+  const auto c_code = code(c);
+  // A node without children has base 0, so would look in slots 1 to 26, none
+  // of which can have it as their parent
+  const auto state = base + c_code;
+  if (c_code == 0 || units_[state].check != cursor.state) {
+    return {};
+  }
+  return Cursor{state};
+}
+
+bool DoubleArrayTrie::is_word(const Cursor cursor) const {
+  return units_[cursor.state].base & word_bit;
+}
+
+bool DoubleArrayTrie::has_further(const Cursor cursor) const {
+  return (units_[cursor.state].base & base_mask) != 0;
+}
+
+std::size_t DoubleArrayTrie::word_id(const Cursor cursor) const {
+  assert(this->is_word(cursor));
+  return first_word_ids_[cursor.state];
+}
+
+std::string DoubleArrayTrie::word(const std::size_t id) const {
+  if (id >= size_) {
+    throw std::out_of_range("Word id out of range of double array trie");
+  }
+  std::string word;
+  auto cursor = this->root();
+  while (!(this->is_word(cursor) && first_word_ids_[cursor.state] == id)) {
+    // Each child's words follow on from its previous sibling's, so id is under
+    // the last child whose first word id isn't greater than it
+    std::optional<Cursor> next;
+    char next_c = 0;
+    for (char c = 'a'; c <= 'z'; ++c) {
+      const auto child = this->child(cursor, c);
+      if (!child) {
+        continue;
+      }
+      if (first_word_ids_[child->state] > id) {
+        break;
+      }
+      next = child;
+      next_c = c;
+    }
+    assert(next);
+    word.push_back(next_c);
+    cursor = *next;
+  }
+  return word;
+}
+
+std::ostream& operator<<(std::ostream& os, const DoubleArrayTrie& dat) {
+  const auto numb_nodes = static_cast<std::size_t>(
+      std::count_if(dat.units_.begin(), dat.units_.end(),
+                    [](const auto& unit) { return unit.check != free_slot; }));
+  return os << fmt::format(
+             "Double array trie of size: {} ({} nodes in {} slots, {} bytes)",
+             dat.size(), numb_nodes, dat.units_.size(), dat.data_size());
+}
+
+} // namespace double_array_trie
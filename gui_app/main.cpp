@@ -140,6 +140,9 @@ public:
     dirty_ = true;
   }
 
+  /** Sort again, for when the words themselves have changed */
+  void set_dirty() { dirty_ = true; }
+
   bool if_dirty_reset() {
     assert(!(lexi_ && by_size_));
     if (dirty_) {
@@ -206,12 +209,27 @@ public:
 class McData {
   using Words = std::vector<std::string>;
   Words dictionary_;
-  solver::WordsearchGrid wordsearch_grid_;
   trie::Trie trie_;
-  solver::WordToListOfListsOfIndexes results_;
+  solver::SolveSession<trie::Trie> session_;
+  solver::ResultStore results_;
   std::map<std::string, std::size_t> word_indexes_selected_;
   std::optional<SelectedWord> selected_word_;
 
+  void update_results() {
+    results_ = solver::ResultStore{session_.grid()};
+    session_.for_each_path(results_);
+    results_.finish();
+
+    result_words.clear();
+    word_indexes_selected_.clear();
+    for (const auto& [word, _] : results_) {
+      result_words.emplace_back(word);
+      word_indexes_selected_[std::string{word}] = 0;
+    }
+    result_words_filtered = result_words;
+    selected_word_.reset();
+  }
+
 public:
   std::vector<CellData> cell_data;
   Words result_words;
@@ -220,13 +238,44 @@ public:
   SortState sort_state = {};
 
   const solver::WordsearchGrid& wordsearch_grid() const {
-    return wordsearch_grid_;
+    return session_.grid();
   }
 
-  solver::WordsearchGrid& wordsearch_grid() { return wordsearch_grid_; }
-
   CellData& cell_at(const solver::Index& index) {
-    return cell_data[index.y * wordsearch_grid_.columns() + index.x];
+    return cell_data[index.y * session_.grid().columns() + index.x];
+  }
+
+  bool cleared(const solver::Index& index) const {
+    return session_.cleared(index);
+  }
+
+  std::vector<solver::Index> user_selected_indexes() const {
+    const auto cols = session_.grid().columns();
+    std::vector<solver::Index> indexes;
+    for (std::size_t i = 0; i < cell_data.size(); ++i) {
+      if (cell_data[i].user_selected) {
+        indexes.push_back(solver::Index{i / cols, i % cols});
+      }
+    }
+    return indexes;
+  }
+
+  // Only the paths through the edited cells are searched again, rather than
+  // solving the whole grid
+  void set_cells(const std::vector<solver::Index>& indexes, const char c) {
+    for (const auto& index : indexes) {
+      session_.set_cell(index, c);
+    }
+    this->update_results();
+    sort_state.set_dirty();
+  }
+
+  void clear_cells(const std::vector<solver::Index>& indexes) {
+    for (const auto& index : indexes) {
+      session_.clear_cell(index);
+    }
+    this->update_results();
+    sort_state.set_dirty();
   }
 
   void unset_all_indexes_selected() {
@@ -248,9 +297,11 @@ public:
   bool selected_word_has_value() const { return selected_word_.has_value(); }
 
   void set_selected_word(const std::string& word) {
-    const auto& lists_of_indexes = results_.at(word);
+    const auto paths = results_.at(word);
     const auto index_selected = word_indexes_selected_.at(word);
-    const auto& indexes = lists_of_indexes[index_selected];
+    const auto indexes =
+        (*std::next(paths.begin(), static_cast<long>(index_selected)))
+            .to_tail();
 
     std::vector<SelectedWord::IndexPosition> index_positions_in_word;
     index_positions_in_word.reserve(word.size());
@@ -302,22 +353,21 @@ public:
   }
 
   McData(const Words& dict, const solver::WordsearchGrid& grid)
-      : dictionary_(dict), wordsearch_grid_(grid), trie_(dict),
-        results_(solver::solve(trie_, grid)) {
-
-    for (auto row = 0UL; row < wordsearch_grid_.rows(); ++row) {
-      for (auto column = 0UL; column < wordsearch_grid_.columns(); ++column) {
+      : dictionary_(dict), trie_(dict), session_(trie_, grid), results_(grid) {
+    for (auto row = 0UL; row < grid.rows(); ++row) {
+      for (auto column = 0UL; column < grid.columns(); ++column) {
         cell_data.emplace_back();
       }
     }
 
-    for (const auto& [word, _] : results_) {
-      result_words.emplace_back(word);
-      word_indexes_selected_[word] = 0;
-    }
-
-    result_words_filtered = result_words;
+    this->update_results();
   }
+
+  // session_ refers to trie_, which would be left behind by a copy or move
+  McData(const McData&) = delete;
+  McData& operator=(const McData&) = delete;
+  McData(McData&&) = delete;
+  McData& operator=(McData&&) = delete;
 };
 
 } // namespace gui_app
@@ -400,6 +450,7 @@ int main(int, char**) {
 
   // Our state
   bool show_demo_window = false;
+  std::string new_letter;
   ImVec4 clear_color = ImVec4(0.45f, 0.55f, 0.60f, 1.00f);
 
   ProfilerRestartDisabled();
@@ -459,8 +510,10 @@ int main(int, char**) {
             ImGui::TableNextRow();
             for (auto column = 0UL; column < cols; column++) {
               ImGui::TableSetColumnIndex(static_cast<int>(column));
-              const std::string s{data.wordsearch_grid()(row, column)};
               const auto index = solver::Index{row, column};
+              // Cleared cells keep their last letter, so show them as a dot
+              const auto letter = data.wordsearch_grid()(row, column);
+              const std::string s{data.cleared(index) ? '.' : letter};
 
               ImGui::PushID(static_cast<int>(row * cols + column));
 
@@ -536,6 +589,23 @@ int main(int, char**) {
         }
       }
 
+      {
+        // Edit the cells the user has selected, such as after a move in
+        // Spelltower, which clears the letters of the word played
+
+        ImGui::InputText("##new_letter", &new_letter);
+        ImGui::SameLine();
+        if (ImGui::Button("Set selected cells") && new_letter.size() == 1) {
+          data.set_cells(data.user_selected_indexes(), new_letter.front());
+          data.unset_all_indexes_selected();
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Clear selected cells")) {
+          data.clear_cells(data.user_selected_indexes());
+          data.unset_all_indexes_selected();
+        }
+      }
+
       {
         // User regex input line
 
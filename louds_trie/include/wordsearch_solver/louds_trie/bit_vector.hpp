@@ -0,0 +1,126 @@
+#ifndef LOUDS_TRIE_BIT_VECTOR_HPP
+#define LOUDS_TRIE_BIT_VECTOR_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace louds_trie {
+
+/** Vector of bits with rank and select.
+ *
+ * Append bits with push_back(), then call build_index() once before any
+ * queries.
+ *
+ * rank1() uses a count of the 1s before every block of 256 bits, then a
+ * popcount of at most 4 words. select0() and select1() start from a sample of
+ * which block every 256th 0 or 1 is in, and scan forward from there. Each
+ * adds 32 bits per 256, so the index is about an eighth of the bits again.
+ *
+ * The queries are defined here rather than in a .cpp so they can be inlined
+ * into the trie's lookups.
+ */
+class BitVector {
+public:
+  void push_back(bool bit);
+
+  /** Build the rank and select index, after the last push_back() */
+  void build_index();
+
+  std::size_t size() const { return size_; }
+
+  bool operator[](const std::size_t i) const {
+    assert(i < size_);
+    return (words_[i / word_bits] >> (i % word_bits)) & 1U;
+  }
+
+  /** @returns The number of 1s in `[0, i)` */
+  std::size_t rank1(const std::size_t i) const {
+    assert(i <= size_);
+    const auto block = i / block_bits;
+    std::size_t rank = block_ranks_[block];
+    for (auto w = block * block_words; w < i / word_bits; ++w) {
+      rank += popcount(words_[w]);
+    }
+    if (const auto bit = i % word_bits; bit != 0) {
+      rank += popcount(words_[i / word_bits] & ((std::uint64_t{1} << bit) - 1));
+    }
+    return rank;
+  }
+
+  /** @returns The number of 0s in `[0, i)` */
+  std::size_t rank0(const std::size_t i) const { return i - this->rank1(i); }
+
+  /** @returns The position of the 0 with @p k 0s before it */
+  std::size_t select0(const std::size_t k) const {
+    return this->select<false>(k, select0_samples_);
+  }
+
+  /** @returns The position of the 1 with @p k 1s before it */
+  std::size_t select1(const std::size_t k) const {
+    return this->select<true>(k, select1_samples_);
+  }
+
+  /** Size of underlying data store in bytes. */
+  std::size_t data_size() const;
+
+private:
+  static constexpr std::size_t word_bits = 64;
+  static constexpr std::size_t block_words = 4;
+  static constexpr std::size_t block_bits = word_bits * block_words;
+  /** A select sample is taken every this many 0s or 1s */
+  static constexpr std::size_t sample_every = 256;
+
+  static std::size_t popcount(const std::uint64_t word) {
+    return static_cast<std::size_t>(__builtin_popcountll(word));
+  }
+
+  /** The number of 1s, or 0s if not @p Ones, before block @p block */
+  template <bool Ones> std::size_t block_rank(const std::size_t block) const {
+    const std::size_t ones = block_ranks_[block];
+    return Ones ? ones : block * block_bits - ones;
+  }
+
+  template <bool Ones>
+  std::size_t select(std::size_t k,
+                     const std::vector<std::uint32_t>& samples) const {
+    // Blocks are never empty of what's being looked for at the sample, so
+    // only scan forward
+    auto block = std::size_t{samples[k / sample_every]};
+    while (block + 1 < block_ranks_.size() &&
+           this->block_rank<Ones>(block + 1) <= k) {
+      ++block;
+    }
+    k -= this->block_rank<Ones>(block);
+    auto w = block * block_words;
+    for (;; ++w) {
+      const auto word = Ones ? words_[w] : ~words_[w];
+      const auto count = popcount(word);
+      if (k < count) {
+        return w * word_bits + select_in_word(word, k);
+      }
+      k -= count;
+    }
+  }
+
+  /** @returns The position of the 1 in @p word with @p k 1s before it */
+  static std::size_t select_in_word(std::uint64_t word, std::size_t k) {
+    for (; k > 0; --k) {
+      word &= word - 1;
+    }
+    return static_cast<std::size_t>(__builtin_ctzll(word));
+  }
+
+  std::vector<std::uint64_t> words_;
+  std::size_t size_ = 0;
+  /** The number of 1s before each block, with one more for the end */
+  std::vector<std::uint32_t> block_ranks_;
+  /** The block that each multiple of sample_every 0 (or 1) is in */
+  std::vector<std::uint32_t> select0_samples_;
+  std::vector<std::uint32_t> select1_samples_;
+};
+
+} // namespace louds_trie
+
+#endif // LOUDS_TRIE_BIT_VECTOR_HPP
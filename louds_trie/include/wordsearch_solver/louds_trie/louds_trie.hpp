@@ -0,0 +1,155 @@
+#ifndef LOUDS_TRIE_HPP
+#define LOUDS_TRIE_HPP
+
+#include "wordsearch_solver/louds_trie/bit_vector.hpp"
+#include "wordsearch_solver/louds_trie/packed_ints.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/** namespace louds_trie */
+namespace louds_trie {
+
+/** Succinct trie, using about 2 bits per node for its shape plus a byte per
+ * node for its letter.
+ *
+ * LOUDS (level order unary degree sequence) numbers the nodes breadth first,
+ * a row at a time the same as the compact_trie, and writes each node's number
+ * of children in unary, as that many 1s then a 0. A "10" for a virtual parent
+ * of the root goes first.
+ *
+ * ```
+ * "a", "an", "at", "be"
+ *
+ *          0            node  super 0     1    2    3    4    5
+ *        a/ \b          bits  10    110   110  10   0    0    0
+ *        1   2          label       -     a    b    n    t    e
+ *      n/ \t  \e
+ *      3   4   5
+ * ```
+ *
+ * The children of node `v` are the 1s after the `v`th 0 (counting from 0), and
+ * since a 1 is numbered by how many 1s come before it, they are the nodes
+ * `[select0(v) - v, select0(v + 1) - v - 1)`. So finding a child is two
+ * select0() on the bits, and a search through the children's letters, which
+ * are next to each other.
+ *
+ * Each node also has a bit for whether it's the end of a word. To give word
+ * ids in sorted order, which breadth first numbering doesn't, each word's id
+ * is stored, and the node for each id, in as few bits as hold them.
+ *
+ * Slower than the compact tries, as every step here scans for a select, so
+ * this is for when memory matters more.
+ *
+ * Unlike the other tries, this works for any chars, not only lowercase ascii.
+ *
+ * Immutable once constructed, so safe to read from multiple threads at once.
+ */
+class LoudsTrie {
+public:
+  /** @copydoc solver::SolverDictWrapper::Cursor
+   *
+   * Holds the node's range of children as well, so that child() only needs
+   * the select0() for the child it finds.
+   */
+  struct Cursor {
+    std::uint32_t node;
+    std::uint32_t first_child;
+    std::uint32_t last_child;
+  };
+
+  LoudsTrie();
+
+  LoudsTrie(LoudsTrie&&) = default;
+  LoudsTrie& operator=(LoudsTrie&&) = default;
+
+  LoudsTrie(const LoudsTrie&) = delete;
+  LoudsTrie& operator=(const LoudsTrie&) = delete;
+
+  LoudsTrie(const std::initializer_list<std::string_view>& words);
+  LoudsTrie(const std::initializer_list<std::string>& words);
+  LoudsTrie(const std::initializer_list<const char*>& words);
+
+  template <class Iterator1, class Iterator2,
+            std::enable_if_t<!std::is_integral_v<Iterator2>, int> = 0>
+  LoudsTrie(Iterator1 first, const Iterator2 last);
+
+  /** Constructs from any range of strings, in any order and with duplicates
+   *
+   * @throws std::length_error If there are more nodes than fit in 32 bits
+   */
+  template <class Strings> explicit LoudsTrie(const Strings& strings_in);
+
+  /** @copydoc solver::SolverDictWrapper::contains() */
+  bool contains(std::string_view word) const;
+  /** @copydoc solver::SolverDictWrapper::further() */
+  bool further(std::string_view word) const;
+
+  /** @copydoc solver::SolverDictWrapper::contains_further() */
+  template <class OutputIterator>
+  void contains_further(std::string_view stem, std::string_view suffixes,
+                        OutputIterator contains_further_it) const;
+
+  /** @copydoc solver::SolverDictWrapper::root() */
+  Cursor root() const;
+  /** @copydoc solver::SolverDictWrapper::child() */
+  std::optional<Cursor> child(Cursor cursor, char c) const;
+  /** @copydoc solver::SolverDictWrapper::is_word() */
+  bool is_word(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::has_further() */
+  bool has_further(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::word_id() */
+  std::size_t word_id(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::word() */
+  std::string word(std::size_t id) const;
+
+  std::size_t size() const;
+  bool empty() const;
+  /** @copydoc solver::SolverDictWrapper::max_word_length() */
+  std::size_t max_word_length() const;
+
+  /** Size of underlying data store in bytes. */
+  std::size_t data_size() const;
+
+  friend std::ostream& operator<<(std::ostream& os, const LoudsTrie& lt);
+
+private:
+  /** Build from @p words, called by the templated constructors */
+  void init(std::vector<std::string> words);
+
+  /** @returns The cursor for @p node, with its children */
+  Cursor make_cursor(std::uint32_t node) const;
+
+  /** Walk @p word from the root as far as it goes
+   *
+   * @returns The node at the end of @p word, or an empty `std::optional` if
+   * the trie has no words starting with it
+   */
+  std::optional<Cursor> search(std::string_view word) const;
+
+  /** The LOUDS bits, see the class description */
+  BitVector louds_;
+  /** The letter of each node but the root, so node v's is at v - 1 */
+  std::vector<char> labels_;
+  /** Whether each node is a word */
+  BitVector is_word_;
+  /** For the nth word node in breadth first order, its id */
+  PackedInts word_ids_;
+  /** For each word id, its node */
+  PackedInts word_nodes_;
+  std::size_t size_ = 0;
+  std::size_t max_word_length_ = 0;
+};
+
+} // namespace louds_trie
+
+#include "wordsearch_solver/louds_trie/louds_trie.tpp"
+
+#endif // LOUDS_TRIE_HPP
@@ -0,0 +1,38 @@
+#ifndef LOUDS_TRIE_TPP
+#define LOUDS_TRIE_TPP
+
+#include "wordsearch_solver/louds_trie/louds_trie.hpp"
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace louds_trie {
+
+template <class Iterator1, class Iterator2,
+          std::enable_if_t<!std::is_integral_v<Iterator2>, int>>
+LoudsTrie::LoudsTrie(Iterator1 first, const Iterator2 last) : LoudsTrie() {
+  this->init(std::vector<std::string>(first, last));
+}
+
+template <class Strings>
+LoudsTrie::LoudsTrie(const Strings& strings_in)
+    : LoudsTrie(strings_in.begin(), strings_in.end()) {}
+
+template <class OutputIterator>
+void LoudsTrie::contains_further(const std::string_view stem,
+                                 const std::string_view suffixes,
+                                 OutputIterator contains_further_it) const {
+  const auto cursor = this->search(stem);
+  for (const auto c : suffixes) {
+    const auto child = cursor ? this->child(*cursor, c) : std::nullopt;
+    *contains_further_it++ = {child && this->is_word(*child),
+                              child && this->has_further(*child)};
+  }
+}
+
+} // namespace louds_trie
+
+#endif // LOUDS_TRIE_TPP
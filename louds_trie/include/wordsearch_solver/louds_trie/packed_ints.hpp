@@ -0,0 +1,77 @@
+#ifndef LOUDS_TRIE_PACKED_INTS_HPP
+#define LOUDS_TRIE_PACKED_INTS_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace louds_trie {
+
+/** Fixed size vector of unsigned ints, each stored in only as many bits as the
+ * largest value it can hold needs.
+ */
+class PackedInts {
+public:
+  PackedInts() = default;
+
+  /** @p size ints, all 0, that can each hold up to @p max_value */
+  PackedInts(const std::size_t size, const std::size_t max_value)
+      : size_(size) {
+    while (max_value >> width_ != 0) {
+      ++width_;
+    }
+    words_.assign((size_ * width_ + word_bits - 1) / word_bits, 0);
+  }
+
+  std::size_t size() const { return size_; }
+
+  std::size_t operator[](const std::size_t i) const {
+    assert(i < size_);
+    const auto bit = i * width_;
+    const auto word = bit / word_bits;
+    const auto offset = bit % word_bits;
+    auto value = words_[word] >> offset;
+    // The rest of the value spills into the next word
+    if (offset + width_ > word_bits) {
+      value |= words_[word + 1] << (word_bits - offset);
+    }
+    return static_cast<std::size_t>(value & this->mask());
+  }
+
+  void set(const std::size_t i, const std::size_t value) {
+    assert(i < size_);
+    assert((value & ~this->mask()) == 0);
+    const auto bit = i * width_;
+    const auto word = bit / word_bits;
+    const auto offset = bit % word_bits;
+    words_[word] &= ~(this->mask() << offset);
+    words_[word] |= std::uint64_t{value} << offset;
+    if (offset + width_ > word_bits) {
+      const auto shift = word_bits - offset;
+      words_[word + 1] &= ~(this->mask() >> shift);
+      words_[word + 1] |= std::uint64_t{value} >> shift;
+    }
+  }
+
+  /** Size of underlying data store in bytes. */
+  std::size_t data_size() const {
+    return words_.size() * sizeof(std::uint64_t);
+  }
+
+private:
+  static constexpr std::size_t word_bits = 64;
+
+  std::uint64_t mask() const {
+    return width_ == 0 ? 0 : ~std::uint64_t{0} >> (word_bits - width_);
+  }
+
+  std::vector<std::uint64_t> words_;
+  std::size_t size_ = 0;
+  /** Bits per int */
+  std::size_t width_ = 0;
+};
+
+} // namespace louds_trie
+
+#endif // LOUDS_TRIE_PACKED_INTS_HPP
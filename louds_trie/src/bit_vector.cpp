@@ -0,0 +1,63 @@
+#include "wordsearch_solver/louds_trie/bit_vector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace louds_trie {
+
+void BitVector::push_back(const bool bit) {
+  if (size_ % word_bits == 0) {
+    words_.push_back(0);
+  }
+  words_.back() |= std::uint64_t{bit} << (size_ % word_bits);
+  ++size_;
+}
+
+void BitVector::build_index() {
+  if (size_ >= std::numeric_limits<std::uint32_t>::max()) {
+    throw std::length_error("Too many bits for a louds trie bit vector");
+  }
+  // Padding the words to a whole block means rank1() and select() never need
+  // to check for the end
+  const auto numb_blocks = (size_ + block_bits - 1) / block_bits;
+  words_.resize(numb_blocks * block_words, 0);
+  words_.shrink_to_fit();
+
+  block_ranks_.assign(numb_blocks + 1, 0);
+  select0_samples_.clear();
+  select1_samples_.clear();
+  std::size_t ones = 0;
+  std::size_t zeros = 0;
+  for (std::size_t i = 0; i < size_; ++i) {
+    if (i % block_bits == 0) {
+      block_ranks_[i / block_bits] = static_cast<std::uint32_t>(ones);
+    }
+    const auto block = static_cast<std::uint32_t>(i / block_bits);
+    if ((*this)[i]) {
+      if (ones % sample_every == 0) {
+        select1_samples_.push_back(block);
+      }
+      ++ones;
+    } else {
+      if (zeros % sample_every == 0) {
+        select0_samples_.push_back(block);
+      }
+      ++zeros;
+    }
+  }
+  block_ranks_.back() = static_cast<std::uint32_t>(ones);
+  select0_samples_.shrink_to_fit();
+  select1_samples_.shrink_to_fit();
+}
+
+std::size_t BitVector::data_size() const {
+  return words_.size() * sizeof(std::uint64_t) +
+         (block_ranks_.size() + select0_samples_.size() +
+          select1_samples_.size()) *
+             sizeof(std::uint32_t);
+}
+
+} // namespace louds_trie
@@ -0,0 +1,184 @@
+#include "wordsearch_solver/louds_trie/louds_trie.hpp"
+#include "wordsearch_solver/utility/utility.hpp"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace louds_trie {
+
+LoudsTrie::LoudsTrie() { this->init({}); }
+
+LoudsTrie::LoudsTrie(const std::initializer_list<std::string_view>& words)
+    : LoudsTrie(words.begin(), words.end()) {}
+
+LoudsTrie::LoudsTrie(const std::initializer_list<std::string>& words)
+    : LoudsTrie(words.begin(), words.end()) {}
+
+LoudsTrie::LoudsTrie(const std::initializer_list<const char*>& words)
+    : LoudsTrie(words.begin(), words.end()) {}
+
+void LoudsTrie::init(std::vector<std::string> words) {
+  std::sort(words.begin(), words.end());
+  words.erase(std::unique(words.begin(), words.end()), words.end());
+
+  louds_ = BitVector{};
+  labels_.clear();
+  is_word_ = BitVector{};
+  // The virtual parent of the root
+  louds_.push_back(true);
+  louds_.push_back(false);
+
+  // Each word's node, in order of id
+  std::vector<std::uint32_t> nodes(words.size());
+  // Each word's id, in breadth first order
+  std::vector<std::uint32_t> ids;
+  ids.reserve(words.size());
+  std::size_t numb_nodes = 0;
+  for (auto row : utility::words_grouped_by_prefix_suffix(words)) {
+    for (auto [prefix, suffixes, is_end_of_word] : row) {
+      if (numb_nodes >= std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("Too many nodes for a louds trie");
+      }
+      for (const char c : suffixes) {
+        louds_.push_back(true);
+        labels_.push_back(c);
+      }
+      louds_.push_back(false);
+      is_word_.push_back(is_end_of_word);
+      if (is_end_of_word) {
+        const auto id = static_cast<std::size_t>(std::distance(
+            words.cbegin(),
+            std::lower_bound(words.cbegin(), words.cend(), prefix)));
+        nodes[id] = static_cast<std::uint32_t>(numb_nodes);
+        ids.push_back(static_cast<std::uint32_t>(id));
+      }
+      ++numb_nodes;
+    }
+  }
+  // No words means no rows, but there's always a root
+  if (numb_nodes == 0) {
+    louds_.push_back(false);
+    is_word_.push_back(false);
+    numb_nodes = 1;
+  }
+  assert(ids.size() == words.size());
+
+  louds_.build_index();
+  is_word_.build_index();
+  labels_.shrink_to_fit();
+
+  size_ = words.size();
+  max_word_length_ = 0;
+  for (const auto& word : words) {
+    max_word_length_ = std::max(max_word_length_, word.size());
+  }
+  word_ids_ = PackedInts(size_, size_);
+  word_nodes_ = PackedInts(size_, numb_nodes);
+  for (std::size_t i = 0; i < size_; ++i) {
+    word_ids_.set(i, ids[i]);
+    word_nodes_.set(i, nodes[i]);
+  }
+}
+
+std::optional<LoudsTrie::Cursor>
+LoudsTrie::search(const std::string_view word) const {
+  std::optional<Cursor> cursor = this->root();
+  for (auto it = word.begin(); cursor && it != word.end(); ++it) {
+    cursor = this->child(*cursor, *it);
+  }
+  return cursor;
+}
+
+bool LoudsTrie::contains(const std::string_view word) const {
+  const auto cursor = this->search(word);
+  return cursor && this->is_word(*cursor);
+}
+
+bool LoudsTrie::further(const std::string_view word) const {
+  const auto cursor = this->search(word);
+  return cursor && this->has_further(*cursor);
+}
+
+std::size_t LoudsTrie::size() const { return size_; }
+
+bool LoudsTrie::empty() const { return size_ == 0; }
+
+std::size_t LoudsTrie::max_word_length() const { return max_word_length_; }
+
+std::size_t LoudsTrie::data_size() const {
+  return louds_.data_size() + labels_.size() * sizeof(char) +
+         is_word_.data_size() + word_ids_.data_size() +
+         word_nodes_.data_size();
+}
+
+LoudsTrie::Cursor LoudsTrie::make_cursor(const std::uint32_t node) const {
+  // See the class description
+  const auto first_child = louds_.select0(node) - node;
+  const auto last_child = louds_.select0(node + 1) - node - 1;
+  return Cursor{node, static_cast<std::uint32_t>(first_child),
+                static_cast<std::uint32_t>(last_child)};
+}
+
+LoudsTrie::Cursor LoudsTrie::root() const { return this->make_cursor(0); }
+
+std::optional<LoudsTrie::Cursor> LoudsTrie::child(const Cursor cursor,
+                                                  const char c) const {
+  // Every node but the root has a label, so node v's is at v - 1
+  const auto first = labels_.begin() + cursor.first_child - 1;
+  const auto last = labels_.begin() + cursor.last_child - 1;
+  const auto it = std::find(first, last, c);
+  if (it == last) {
+    return {};
+  }
+  return this->make_cursor(
+      static_cast<std::uint32_t>(std::distance(labels_.begin(), it) + 1));
+}
+
+bool LoudsTrie::is_word(const Cursor cursor) const {
+  return is_word_[cursor.node];
+}
+
+bool LoudsTrie::has_further(const Cursor cursor) const {
+  return cursor.first_child != cursor.last_child;
+}
+
+std::size_t LoudsTrie::word_id(const Cursor cursor) const {
+  assert(this->is_word(cursor));
+  return word_ids_[is_word_.rank1(cursor.node)];
+}
+
+std::string LoudsTrie::word(const std::size_t id) const {
+  if (id >= size_) {
+    throw std::out_of_range("Word id out of range of louds trie");
+  }
+  // Walk up to the root, node v being the 1 with v 1s before it, under the
+  // parent whose 0s end before it
+  std::string word;
+  for (auto node = word_nodes_[id]; node != 0;
+       node = louds_.rank0(louds_.select1(node)) - 1) {
+    word.push_back(labels_[node - 1]);
+  }
+  std::reverse(word.begin(), word.end());
+  return word;
+}
+
+std::ostream& operator<<(std::ostream& os, const LoudsTrie& lt) {
+  return os << fmt::format("Louds trie of size: {} ({} nodes, {} bytes)",
+                           lt.size(), lt.is_word_.size(), lt.data_size());
+}
+
+} // namespace louds_trie
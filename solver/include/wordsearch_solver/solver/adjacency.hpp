@@ -0,0 +1,104 @@
+#ifndef ADJACENCY_HPP
+#define ADJACENCY_HPP
+
+#include "matrix2d/matrix2d.hpp"
+
+#include <range/v3/view/span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace solver {
+
+/** The shape of the graph of which cells are next to which in an Adjacency */
+enum class Topology {
+  /** A rectangle, each cell next to the up to 8 cells around it. The same as
+   * solve() without an Adjacency.
+   */
+  eight,
+  /** A rectangle, each cell next to the up to 4 cells above, below, left and
+   * right of it
+   */
+  four,
+  /** Hexagons, laid out in rows with each odd row shifted right by half a
+   * cell. Each cell is next to the 2 cells either side of it, and to 2 cells
+   * in each of the rows above and below it.
+   */
+  hex,
+  /** Like eight, but the left and right edges wrap around to each other, as
+   * do the top and bottom
+   */
+  torus,
+};
+
+/** Which cells of a grid are next to which, for solve() to search paths along.
+ *
+ * Held as a list of neighbours per cell, all in one array. Cells can also be
+ * removed, such as those cleared from a Spelltower board, so that paths never
+ * go through them.
+ *
+ * Cells are numbered `y * columns + x`.
+ */
+class Adjacency {
+  std::size_t rows_ = 0;
+  std::size_t columns_ = 0;
+  /** Neighbours of cell `c` are `[neighbour_begin_[c], neighbour_begin_[c+1])`
+   */
+  std::vector<std::uint32_t> neighbour_begin_;
+  std::vector<std::uint32_t> neighbours_;
+  /** For at most 64 cells, the bitboard of each cell's neighbours */
+  std::vector<std::uint64_t> neighbour_masks_;
+  std::vector<unsigned char> removed_;
+
+  void init(const std::vector<std::vector<std::size_t>>& neighbours);
+
+public:
+  /** Constructs the adjacency of a @p rows x @p columns grid of shape
+   * @p topology
+   */
+  Adjacency(std::size_t rows, std::size_t columns,
+            Topology topology = Topology::eight);
+
+  /** Constructs any adjacency of a @p rows x @p columns grid
+   *
+   * @param[in] neighbours For cell `(y, x)`, `neighbours[y * columns + x]` is
+   * the cells next to it, in any order
+   * @throws std::out_of_range If there is not one list per cell, or any index
+   * is not in the grid
+   */
+  Adjacency(std::size_t rows, std::size_t columns,
+            const std::vector<std::vector<matrix2d::Index>>& neighbours);
+
+  std::size_t rows() const;
+  std::size_t columns() const;
+  /** The number of cells, including removed ones */
+  std::size_t size() const;
+
+  /** Remove @p cell, so that no path will go through it
+   *
+   * @throws std::out_of_range If @p cell is not in the grid
+   */
+  void remove(matrix2d::Index cell);
+
+  /** Put back @p cell after remove(), so that paths may go through it again
+   *
+   * @throws std::out_of_range If @p cell is not in the grid
+   */
+  void restore(matrix2d::Index cell);
+
+  /** Checks if @p cell has been removed */
+  bool removed(std::size_t cell) const;
+
+  /** The cells next to @p cell, in ascending order, including removed ones */
+  ranges::span<const std::uint32_t> neighbours(std::size_t cell) const;
+
+  /** The bitboard of each cell's neighbours, with bit `c` for cell `c`.
+   * Empty if there are more than 64 cells.
+   */
+  const std::vector<std::uint64_t>& neighbour_masks() const;
+};
+
+} // namespace solver
+
+#endif // ADJACENCY_HPP
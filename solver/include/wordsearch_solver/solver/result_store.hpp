@@ -0,0 +1,338 @@
+#ifndef RESULT_STORE_HPP
+#define RESULT_STORE_HPP
+
+#include "wordsearch_solver/solver/solver.hpp"
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace solver {
+
+/** How much a ResultStore records about each word solve() finds.
+ *
+ * The cheaper modes skip copying a path once its word has been recorded, and
+ * solving with one of them skips even building the paths they won't keep.
+ */
+enum class ResultMode {
+  /** Every path of every word */
+  all_paths,
+  /** The first path found for each word, later ones are only counted */
+  first_path_per_word,
+  /** Just which words were found, no paths */
+  words_only,
+  /** Nothing but the number of paths found, so nothing is allocated per path
+   * or per word
+   */
+  count_only,
+};
+
+/** Compact container of the words solve() finds and the paths spelling them.
+ *
+ * An alternative to WordToListOfListsOfIndexes, which makes a heap allocation
+ * for every path. Here every path's cells are packed into one arena as ids
+ * `y * columns + x`, `uint16_t` ones if the grid has at most 65536 cells, else
+ * `uint32_t`. A path is then recorded as a span of that arena. add() appends
+ * spans in the order paths are found, and finish() then groups them by word,
+ * so that each word's paths are one contiguous run.
+ *
+ * A ResultStore is a sink for solve(), so fill one with
+ * @code
+ * solver::ResultStore results{grid};
+ * solver::solve(solver_dict, grid, results);
+ * results.finish();
+ * @endcode
+ *
+ * Iterating over a ResultStore gives `std::pair<std::string_view, Paths>` in
+ * the order the words were first found.
+ *
+ * What is kept of each word added depends on the ResultMode it was
+ * constructed with, see add().
+ */
+class ResultStore {
+  struct WordEntry {
+    std::uint32_t chars_offset;
+    std::uint32_t size;
+    /** The word's paths are paths_[first_path, last_path) */
+    std::uint32_t first_path;
+    std::uint32_t last_path;
+  };
+
+  struct PathEntry {
+    std::uint32_t cells_offset;
+    std::uint32_t size;
+  };
+
+  struct PendingPath {
+    std::uint32_t word_id;
+    PathEntry path;
+  };
+
+  static constexpr std::uint32_t no_word = UINT32_MAX;
+
+  std::size_t columns_ = 0;
+  ResultMode mode_ = ResultMode::all_paths;
+  std::size_t numb_found_ = 0;
+  std::variant<std::vector<std::uint16_t>, std::vector<std::uint32_t>> cells_;
+  /** Every word's paths, grouped by word as of the last finish() */
+  std::vector<PathEntry> paths_;
+  /** Paths added since the last finish(), in the order they were added */
+  std::vector<PendingPath> pending_;
+  std::vector<WordEntry> words_;
+  /** All words' chars back to back */
+  std::string chars_;
+  /** Open addressing hash table of word ids + 1, 0 marks an empty slot */
+  std::vector<std::uint32_t> word_slots_;
+
+  std::string_view word(std::uint32_t word_id) const;
+  std::uint32_t find_word(std::string_view word) const;
+  std::uint32_t insert_word(std::string_view word);
+  Index cell(std::size_t offset) const;
+  void check_finished() const;
+
+public:
+  class PathView;
+  class Paths;
+  class const_iterator;
+
+  /** Constructs a store for a 0 x 0 grid, which can hold no paths */
+  ResultStore() = default;
+
+  /** Constructs an empty store for paths in @p grid
+   *
+   * @param[in] grid The grid that paths will be in
+   * @param[in] mode What add() keeps of each word
+   */
+  explicit ResultStore(const WordsearchGrid& grid,
+                       ResultMode mode = ResultMode::all_paths);
+
+  /** Record that @p path spells out @p word
+   *
+   * With ResultMode::all_paths the word and path are always kept. With
+   * ResultMode::first_path_per_word the path is only kept if it is the first
+   * for @p word, and with ResultMode::words_only just the word is kept. With
+   * ResultMode::count_only nothing is, and no word will ever be contained.
+   * numb_found() is incremented whatever the mode.
+   *
+   * Paths kept are not readable until finish() is called.
+   *
+   * @param[in] word The word found
+   * @param[in] path The indexes of each letter of @p word in the grid
+   * @throws std::logic_error If this was default constructed, so has no grid
+   */
+  void add(std::string_view word, Path path);
+
+  /** Same as add(), so that this can be passed to solve() as a sink */
+  void operator()(std::string_view word, Path path) { this->add(word, path); }
+
+  /** Count a path found without passing it to add(), for a caller that knows
+   * the mode would keep nothing of it
+   */
+  void count_found();
+
+  /** Group the paths added since the last call by word, so that each word's
+   * paths can be read as one contiguous run. Call this after the last add()
+   * and before at(), iterating or to_map().
+   */
+  void finish();
+
+  /** The number of different words */
+  std::size_t size() const;
+
+  /** Checks if there are no words */
+  bool empty() const;
+
+  /** The number of paths of all words */
+  std::size_t numb_paths() const;
+
+  /** The number of times add() was called, including for paths not kept */
+  std::size_t numb_found() const;
+
+  /** What add() keeps of each word */
+  ResultMode mode() const;
+
+  /** Check if any path for @p word has been added */
+  bool contains(std::string_view word) const;
+
+  /** The paths for @p word, in the order they were added
+   *
+   * @throws std::out_of_range If there is no @p word
+   * @throws std::logic_error If paths were added since the last finish()
+   */
+  Paths at(std::string_view word) const;
+
+  /** @throws std::logic_error If paths were added since the last finish() */
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  /** Copy out the contents as the map solve() returns
+   *
+   * @throws std::logic_error If paths were added since the last finish()
+   */
+  WordToListOfListsOfIndexes to_map() const;
+};
+
+/** The indexes of one path, decoded from the cell ids on access */
+class ResultStore::PathView {
+  const ResultStore* store_;
+  std::size_t offset_;
+  std::size_t size_;
+
+  friend class ResultStore;
+  PathView(const ResultStore* store, std::size_t offset, std::size_t size)
+      : store_(store), offset_(offset), size_(size) {}
+
+public:
+  class const_iterator
+      : public boost::iterator_facade<const_iterator, Index,
+                                      boost::random_access_traversal_tag,
+                                      Index> {
+    const ResultStore* store_ = nullptr;
+    std::size_t offset_ = 0;
+
+    friend class boost::iterator_core_access;
+    friend class PathView;
+    const_iterator(const ResultStore* store, std::size_t offset)
+        : store_(store), offset_(offset) {}
+
+    Index dereference() const { return store_->cell(offset_); }
+    bool equal(const const_iterator& other) const {
+      return offset_ == other.offset_;
+    }
+    void increment() { ++offset_; }
+    void decrement() { --offset_; }
+    void advance(std::ptrdiff_t n) {
+      offset_ = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(offset_) +
+                                         n);
+    }
+    std::ptrdiff_t distance_to(const const_iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other.offset_) -
+             static_cast<std::ptrdiff_t>(offset_);
+    }
+
+  public:
+    const_iterator() = default;
+  };
+
+  std::size_t size() const { return size_; }
+  Index operator[](std::size_t i) const { return store_->cell(offset_ + i); }
+  const_iterator begin() const { return {store_, offset_}; }
+  const_iterator end() const { return {store_, offset_ + size_}; }
+  /** Copy out the indexes */
+  Tail to_tail() const { return {this->begin(), this->end()}; }
+};
+
+/** The paths of one word, in the order they were added */
+class ResultStore::Paths {
+  const ResultStore* store_;
+  std::uint32_t word_id_;
+
+  friend class ResultStore;
+  Paths(const ResultStore* store, std::uint32_t word_id)
+      : store_(store), word_id_(word_id) {}
+
+public:
+  class const_iterator
+      : public boost::iterator_facade<const_iterator, PathView,
+                                      boost::random_access_traversal_tag,
+                                      PathView> {
+    const ResultStore* store_ = nullptr;
+    std::uint32_t path_id_ = 0;
+
+    friend class boost::iterator_core_access;
+    friend class Paths;
+    const_iterator(const ResultStore* store, std::uint32_t path_id)
+        : store_(store), path_id_(path_id) {}
+
+    PathView dereference() const {
+      const auto& path = store_->paths_[path_id_];
+      return {store_, path.cells_offset, path.size};
+    }
+    bool equal(const const_iterator& other) const {
+      return path_id_ == other.path_id_;
+    }
+    void increment() { ++path_id_; }
+    void decrement() { --path_id_; }
+    void advance(std::ptrdiff_t n) {
+      path_id_ = static_cast<std::uint32_t>(
+          static_cast<std::ptrdiff_t>(path_id_) + n);
+    }
+    std::ptrdiff_t distance_to(const const_iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other.path_id_) -
+             static_cast<std::ptrdiff_t>(path_id_);
+    }
+
+  public:
+    const_iterator() = default;
+  };
+
+  std::size_t size() const {
+    const auto& entry = store_->words_[word_id_];
+    return entry.last_path - entry.first_path;
+  }
+  const_iterator begin() const {
+    return {store_, store_->words_[word_id_].first_path};
+  }
+  const_iterator end() const {
+    return {store_, store_->words_[word_id_].last_path};
+  }
+};
+
+class ResultStore::const_iterator
+    : public boost::iterator_facade<
+          const_iterator, std::pair<std::string_view, Paths>,
+          boost::random_access_traversal_tag,
+          std::pair<std::string_view, Paths>> {
+  const ResultStore* store_ = nullptr;
+  std::uint32_t word_id_ = 0;
+
+  friend class boost::iterator_core_access;
+  friend class ResultStore;
+  const_iterator(const ResultStore* store, std::uint32_t word_id)
+      : store_(store), word_id_(word_id) {}
+
+  std::pair<std::string_view, Paths> dereference() const {
+    return {store_->word(word_id_), Paths{store_, word_id_}};
+  }
+  bool equal(const const_iterator& other) const {
+    return word_id_ == other.word_id_;
+  }
+  void increment() { ++word_id_; }
+  void decrement() { --word_id_; }
+  void advance(std::ptrdiff_t n) {
+    word_id_ = static_cast<std::uint32_t>(
+        static_cast<std::ptrdiff_t>(word_id_) + n);
+  }
+  std::ptrdiff_t distance_to(const const_iterator& other) const {
+    return static_cast<std::ptrdiff_t>(other.word_id_) -
+           static_cast<std::ptrdiff_t>(word_id_);
+  }
+
+public:
+  const_iterator() = default;
+};
+
+/** Like solve(), but into a ResultStore recording only what @p mode asks for.
+ * Words and paths @p mode wouldn't keep are counted but not built.
+ *
+ * @param[in] solver_dict The solver dictionary implementation to use, for
+ * example SolverDictWrapper
+ * @param[in] grid The wordsearch matrix/grid to solve
+ * @param[in] mode What to record about each word found
+ * @returns The words found, in the order they were first found
+ */
+template <class SolverDict>
+ResultStore solve(const SolverDict& solver_dict, const WordsearchGrid& grid,
+                  ResultMode mode);
+
+} // namespace solver
+
+#include "wordsearch_solver/solver/result_store.tpp"
+
+#endif // RESULT_STORE_HPP
@@ -0,0 +1,81 @@
+#ifndef RESULT_STORE_TPP
+#define RESULT_STORE_TPP
+
+#include "wordsearch_solver/solver/result_store.hpp"
+#include "wordsearch_solver/solver/solver.hpp"
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace solver {
+
+namespace detail {
+
+/** Emit for search_task() filling a ResultStore, which turns down the words
+ * whose paths the store's mode wouldn't keep, so they are never built
+ */
+template <class SolverDict> class ResultStoreEmit {
+  const SolverDict& solver_dict_;
+  ResultStore& results_;
+  /** Whether each word id has been passed to results_ yet, for the modes that
+   * only keep a word's first path
+   */
+  std::vector<bool> recorded_;
+
+public:
+  ResultStoreEmit(const SolverDict& solver_dict, ResultStore& results)
+      : solver_dict_(solver_dict), results_(results) {
+    if (results_.mode() == ResultMode::first_path_per_word ||
+        results_.mode() == ResultMode::words_only) {
+      recorded_.resize(solver_dict_.size());
+    }
+  }
+
+  template <class Cursor> bool wants(const Cursor& cursor) {
+    if (results_.mode() == ResultMode::all_paths) {
+      return true;
+    }
+    if (results_.mode() != ResultMode::count_only) {
+      const auto word_id = solver_dict_.word_id(cursor);
+      if (!recorded_[word_id]) {
+        recorded_[word_id] = true;
+        return true;
+      }
+    }
+    results_.count_found();
+    return false;
+  }
+
+  template <class Cursor>
+  void operator()(const std::string_view word, const Path path,
+                  const Cursor&) {
+    results_.add(word, path);
+  }
+};
+
+} // namespace detail
+
+template <class SolverDict>
+ResultStore solve(const SolverDict& solver_dict, const WordsearchGrid& grid,
+                  const ResultMode mode) {
+  if constexpr (detail::is_wrapper_v<SolverDict>) {
+    return solver_dict.visit(
+        [&](const auto& t) { return solve(t, grid, mode); });
+  } else {
+    ResultStore results{grid, mode};
+    detail::ResultStoreEmit<SolverDict> emit{solver_dict, results};
+    SolverWorkspace<SolverDict> workspace{grid};
+    for (std::size_t y = 0; y < grid.rows(); ++y) {
+      for (std::size_t x = 0; x < grid.columns(); ++x) {
+        detail::search_from(solver_dict, grid, Index{y, x}, emit, workspace);
+      }
+    }
+    results.finish();
+    return results;
+  }
+}
+
+} // namespace solver
+
+#endif // RESULT_STORE_TPP
@@ -0,0 +1,108 @@
+#ifndef SOLVE_SESSION_HPP
+#define SOLVE_SESSION_HPP
+
+#include "wordsearch_solver/solver/adjacency.hpp"
+#include "wordsearch_solver/solver/solver.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace solver {
+
+/** A solved grid that is kept up to date as single cells are edited, such as
+ * in a Spelltower style game where each move changes only a few cells.
+ *
+ * Every path found is indexed by each cell it goes through. Editing a cell
+ * drops only the paths through it, then searches again for just the paths
+ * that now go through it. Searches start only from cells near enough to the
+ * edited one for the longest word that may be found to reach it, and stop
+ * going further from it once that is no longer possible.
+ *
+ * Paths step between any of the 8 cells around each, like solve(). Cleared
+ * cells are never part of a path.
+ *
+ * The session refers to the dictionary it was constructed with, which must
+ * outlive it.
+ */
+template <class SolverDict> class SolveSession {
+  struct FoundPath {
+    std::string word;
+    /** Empty if this slot is free */
+    Tail path;
+  };
+
+  const SolverDict& solver_dict_;
+  WordsearchGrid grid_;
+  Adjacency adjacency_;
+  SolverWorkspace<SolverDict> workspace_;
+  LengthLimits limits_;
+  /** Length of the longest word that can be found */
+  std::size_t max_length_ = 0;
+  std::vector<FoundPath> paths_;
+  std::vector<std::size_t> free_paths_;
+  /** For cell `y * columns + x`, the ids in paths_ of paths through it */
+  std::vector<std::vector<std::size_t>> paths_through_;
+  std::size_t numb_paths_ = 0;
+
+  std::size_t cell(Index index) const;
+  void add(std::string_view word, Path path);
+  void drop_paths_through(Index index);
+  /** Add the paths through @p through, or every path if there is none */
+  void search(std::optional<Index> through);
+
+public:
+  /** Solves @p grid with @p solver_dict, keeping the results to update
+   *
+   * @param[in] limits Lengths of words to find, as for solve(). The lower the
+   * maximum, the fewer cells around an edited one need searching again.
+   * @throws std::runtime_error If `limits.min_length > limits.max_length`
+   */
+  SolveSession(const SolverDict& solver_dict, WordsearchGrid grid,
+               LengthLimits limits = {});
+
+  /** The grid as edited so far. Cleared cells keep their last letter. */
+  const WordsearchGrid& grid() const;
+
+  /** Checks if @p index has been cleared */
+  bool cleared(Index index) const;
+
+  /** Set the letter at @p index to @p c, putting it back if it was cleared,
+   * and update the paths through it
+   *
+   * @throws std::out_of_range If @p index is not in the grid
+   */
+  void set_cell(Index index, char c);
+
+  /** Clear the cell at @p index, dropping the paths through it
+   *
+   * @throws std::out_of_range If @p index is not in the grid
+   */
+  void clear_cell(Index index);
+
+  /** The number of paths of all words */
+  std::size_t numb_paths() const;
+
+  /** Calls `sink(word, path)` with a `std::string_view` and a Path for every
+   * path currently found, in no particular order. A ResultStore may be used as
+   * @p sink.
+   */
+  template <class Sink,
+            std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                             int> = 0>
+  void for_each_path(Sink&& sink) const;
+
+  /** Copy out the paths as the map solve() would return for the edited grid,
+   * with each word's lists of indexes in the same order
+   */
+  WordToListOfListsOfIndexes to_map() const;
+};
+
+} // namespace solver
+
+#include "wordsearch_solver/solver/solve_session.tpp"
+
+#endif // SOLVE_SESSION_HPP
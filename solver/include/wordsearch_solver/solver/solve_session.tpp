@@ -0,0 +1,210 @@
+#ifndef SOLVE_SESSION_TPP
+#define SOLVE_SESSION_TPP
+
+#include "wordsearch_solver/solver/adjacency.hpp"
+#include "wordsearch_solver/solver/solve_session.hpp"
+#include "wordsearch_solver/solver/solver.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace solver {
+
+template <class SolverDict>
+SolveSession<SolverDict>::SolveSession(const SolverDict& solver_dict,
+                                       WordsearchGrid grid,
+                                       const LengthLimits limits)
+    : solver_dict_(solver_dict), grid_(std::move(grid)),
+      adjacency_(grid_.rows(), grid_.columns()), workspace_(grid_),
+      limits_(limits), paths_through_(grid_.size()) {
+  detail::throw_if_invalid(limits_);
+  max_length_ = detail::max_word_length(solver_dict_, limits_);
+  if (!grid_.empty() && max_length_ > 0) {
+    this->search(std::nullopt);
+  }
+}
+
+template <class SolverDict>
+std::size_t SolveSession<SolverDict>::cell(const Index index) const {
+  return index.y * grid_.columns() + index.x;
+}
+
+template <class SolverDict>
+void SolveSession<SolverDict>::add(const std::string_view word,
+                                   const Path path) {
+  std::size_t id = paths_.size();
+  if (free_paths_.empty()) {
+    paths_.emplace_back();
+  } else {
+    id = free_paths_.back();
+    free_paths_.pop_back();
+  }
+  paths_[id].word.assign(word);
+  paths_[id].path.assign(path.begin(), path.end());
+  for (const auto index : path) {
+    paths_through_[this->cell(index)].push_back(id);
+  }
+  ++numb_paths_;
+}
+
+template <class SolverDict>
+void SolveSession<SolverDict>::drop_paths_through(const Index index) {
+  const auto dropped = std::move(paths_through_[this->cell(index)]);
+  paths_through_[this->cell(index)].clear();
+  for (const auto id : dropped) {
+    for (const auto other : paths_[id].path) {
+      if (other == index) {
+        continue;
+      }
+      auto& ids = paths_through_[this->cell(other)];
+      ids.erase(std::find(ids.begin(), ids.end(), id));
+    }
+    paths_[id].path.clear();
+    free_paths_.push_back(id);
+    --numb_paths_;
+  }
+}
+
+template <class SolverDict>
+void SolveSession<SolverDict>::search(const std::optional<Index> through) {
+  const auto rows = grid_.rows();
+  const auto cols = grid_.columns();
+  const auto& masks = adjacency_.neighbour_masks();
+  auto emit = [this, through](const std::string_view word, const Path path,
+                              const auto&) {
+    if (!through || std::find(path.begin(), path.end(), *through) !=
+                        path.end()) {
+      this->add(word, path);
+    }
+  };
+  detail::NoDonor donor;
+
+  // As in solve() with an Adjacency, cleared cells stay marked as visited
+  std::uint64_t visited_bits = 0;
+  std::vector<unsigned char> visited;
+  if (masks.empty()) {
+    visited.resize(adjacency_.size());
+  }
+  for (std::size_t cell = 0; cell < adjacency_.size(); ++cell) {
+    if (!adjacency_.removed(cell)) {
+      continue;
+    }
+    if (masks.empty()) {
+      visited[cell] = 1;
+    } else {
+      visited_bits |= std::uint64_t{1} << cell;
+    }
+  }
+
+  // Fewest steps to through, with 8 neighbours per cell
+  const auto distance = [through](const Index index) {
+    const auto dy =
+        index.y > through->y ? index.y - through->y : through->y - index.y;
+    const auto dx =
+        index.x > through->x ? index.x - through->x : through->x - index.x;
+    return std::max(dy, dx);
+  };
+  const auto search_with = [&](detail::SearchTask task, auto visited_set) {
+    if (through) {
+      detail::search_task(solver_dict_, grid_, std::move(task), emit, donor,
+                          workspace_,
+                          detail::TowardsVisited{std::move(visited_set),
+                                                 distance, max_length_},
+                          limits_);
+    } else {
+      detail::search_task(solver_dict_, grid_, std::move(task), emit, donor,
+                          workspace_, std::move(visited_set), limits_);
+    }
+  };
+
+  // Only start from cells near enough for a path to reach through
+  std::size_t first_row = 0;
+  std::size_t first_column = 0;
+  std::size_t last_row = rows - 1;
+  std::size_t last_column = cols - 1;
+  if (through) {
+    const auto reach = max_length_ - 1;
+    first_row = through->y > reach ? through->y - reach : 0;
+    first_column = through->x > reach ? through->x - reach : 0;
+    last_row = std::min(last_row, through->y + reach);
+    last_column = std::min(last_column, through->x + reach);
+  }
+  for (auto y = first_row; y <= last_row; ++y) {
+    for (auto x = first_column; x <= last_column; ++x) {
+      if (adjacency_.removed(y * cols + x)) {
+        continue;
+      }
+      detail::SearchTask task{{}, {Index{y, x}}, false};
+      if (masks.empty()) {
+        search_with(std::move(task),
+                    detail::GraphVisited{visited, adjacency_, cols});
+      } else {
+        search_with(std::move(task),
+                    detail::BitboardVisited{visited_bits, masks, cols});
+      }
+    }
+  }
+}
+
+template <class SolverDict>
+const WordsearchGrid& SolveSession<SolverDict>::grid() const {
+  return grid_;
+}
+
+template <class SolverDict>
+bool SolveSession<SolverDict>::cleared(const Index index) const {
+  return adjacency_.removed(this->cell(index));
+}
+
+template <class SolverDict>
+void SolveSession<SolverDict>::set_cell(const Index index, const char c) {
+  adjacency_.restore(index);
+  this->drop_paths_through(index);
+  grid_(index) = c;
+  if (max_length_ > 0) {
+    this->search(index);
+  }
+}
+
+template <class SolverDict>
+void SolveSession<SolverDict>::clear_cell(const Index index) {
+  adjacency_.remove(index);
+  this->drop_paths_through(index);
+}
+
+template <class SolverDict>
+std::size_t SolveSession<SolverDict>::numb_paths() const {
+  return numb_paths_;
+}
+
+template <class SolverDict>
+template <class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                           int>>
+void SolveSession<SolverDict>::for_each_path(Sink&& sink) const {
+  for (const auto& found : paths_) {
+    if (!found.path.empty()) {
+      sink(std::string_view{found.word}, Path{found.path});
+    }
+  }
+}
+
+template <class SolverDict>
+WordToListOfListsOfIndexes SolveSession<SolverDict>::to_map() const {
+  WordToListOfListsOfIndexes word_to_list_of_indexes;
+  this->for_each_path(detail::map_sink(word_to_list_of_indexes));
+
+  detail::sort_as_solved(word_to_list_of_indexes);
+  return word_to_list_of_indexes;
+}
+
+} // namespace solver
+
+#endif // SOLVE_SESSION_TPP
@@ -0,0 +1,89 @@
+#ifndef SOLVE_STREAM_HPP
+#define SOLVE_STREAM_HPP
+
+#include "wordsearch_solver/solver/solver.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace solver {
+
+/** Solves a grid that arrives one row at a time, such as from a scanner,
+ * reporting each word as soon as all of its path has arrived.
+ *
+ * A path of at most `max_length` letters through a new row can reach no more
+ * than `max_length - 1` rows above it, so only those rows are kept, in a ring
+ * of `max_length` rows each new row overwrites the oldest of. Each row
+ * pushed is solved for just the paths that go through it, within those rows,
+ * and a search stops going up once it could no longer get back down to the
+ * new row. Every path is reported once, by the first row pushed that has all
+ * of it, so all that is reported for a grid is what solve() finds in it.
+ *
+ * The stream refers to the dictionary it was constructed with, which must
+ * outlive it.
+ */
+template <class SolverDict> class SolveStream {
+  const SolverDict& solver_dict_;
+  std::size_t columns_;
+  LengthLimits limits_;
+  /** Length of the longest word that can be found */
+  std::size_t max_length_ = 0;
+  std::size_t numb_rows_ = 0;
+  /** The rows a path through the next row pushed may reach, as a ring with
+   * row `r` of the grid pushed in row `r % window_.rows()`
+   */
+  WordsearchGrid window_;
+  std::vector<unsigned char> visited_;
+  /** The ring row of each row of the window, oldest first */
+  std::vector<std::size_t> ring_rows_;
+  /** The position in the window of each ring row, 0 for the oldest */
+  std::vector<std::size_t> ages_;
+  /** For a window of at most bitboard_max_cells cells, the bitboard of each
+   * cell's neighbours, redone for each row pushed
+   */
+  std::vector<std::uint64_t> neighbour_masks_;
+  SolverWorkspace<SolverDict> workspace_;
+  /** A path found, with indexes within the whole grid */
+  Tail path_;
+
+public:
+  /** Constructs a stream of rows of @p columns letters, to solve with
+   * @p solver_dict
+   *
+   * @param[in] limits Lengths of words to find, as for solve(). The lower the
+   * maximum, the fewer rows need searching for each row pushed.
+   * @throws std::runtime_error If `limits.min_length > limits.max_length`
+   */
+  SolveStream(const SolverDict& solver_dict, std::size_t columns,
+              LengthLimits limits = {});
+
+  std::size_t columns() const;
+
+  /** The number of rows pushed so far */
+  std::size_t rows() const;
+
+  /** Add @p row below the rows pushed so far, and report the words found
+   * along paths through it.
+   *
+   * @param[in] row The letters of the row
+   * @param[in] sink Called as `sink(word, path)` with a `std::string_view` and
+   * a Path for every path through @p row. Indexes are within the whole grid,
+   * with row 0 the first pushed. As with solve(), both are only valid until
+   * @p sink returns.
+   * @throws std::runtime_error If @p row is not columns() letters long
+   */
+  template <class Sink,
+            std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                             int> = 0>
+  void push_row(std::string_view row, Sink&& sink);
+};
+
+} // namespace solver
+
+#include "wordsearch_solver/solver/solve_stream.tpp"
+
+#endif // SOLVE_STREAM_HPP
@@ -0,0 +1,174 @@
+#ifndef SOLVE_STREAM_TPP
+#define SOLVE_STREAM_TPP
+
+#include "wordsearch_solver/solver/solve_stream.hpp"
+#include "wordsearch_solver/solver/solver.hpp"
+
+#include <fmt/core.h>
+#include <range/v3/view/span.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace solver {
+
+namespace detail {
+
+/** Visited set for search_task() over the window of a SolveStream, with one
+ * entry per cell `y * cols + x` of the ring of rows it is held in.
+ *
+ * Ring rows are next to each other when they are next to each other in the
+ * window, the newest row is not next to the oldest.
+ */
+struct RingVisited {
+  std::vector<unsigned char>& visited;
+  /** The ring row of each row of the window, oldest first */
+  const std::vector<std::size_t>& ring_rows;
+  /** The position in the window of each ring row, 0 for the oldest */
+  const std::vector<std::size_t>& ages;
+  /** The number of rows in the window */
+  std::size_t numb_rows;
+  std::size_t cols;
+
+  using Cell = Index;
+  Cell cell(const Index index) const { return index; }
+  Index index(const Cell cell) const { return cell; }
+
+  bool contains(const Index index) const {
+    return visited[index.y * cols + index.x];
+  }
+  void insert(const Index index) { visited[index.y * cols + index.x] = 1; }
+  void erase(const Index index) { visited[index.y * cols + index.x] = 0; }
+
+  /** Calls @p func with each index adjacent to @p n not in the set */
+  template <class Func>
+  void for_each_unvisited_neighbour(const Index n, Func&& func) const {
+    const auto age = ages[n.y];
+    for (auto a = age > 0 ? age - 1 : age; a <= age + 1 && a < numb_rows; ++a) {
+      const auto y = ring_rows[a];
+      for (auto x = n.x > 0 ? n.x - 1 : n.x; x <= n.x + 1 && x < cols; ++x) {
+        if ((y != n.y || x != n.x) && !visited[y * cols + x]) {
+          func(Index{y, x});
+        }
+      }
+    }
+  }
+};
+
+} // namespace detail
+
+template <class SolverDict>
+SolveStream<SolverDict>::SolveStream(const SolverDict& solver_dict,
+                                     const std::size_t columns,
+                                     const LengthLimits limits)
+    : solver_dict_(solver_dict), columns_(columns), limits_(limits),
+      max_length_(detail::max_word_length(solver_dict, limits)),
+      // Rows further up than this can't be reached by a path through the
+      // newest row
+      window_(std::max(max_length_, std::size_t{1}), columns),
+      visited_(window_.size()), ring_rows_(window_.rows()),
+      ages_(window_.rows()) {
+  detail::throw_if_invalid(limits_);
+  if (window_.size() <= detail::bitboard_max_cells) {
+    neighbour_masks_.resize(window_.size());
+  }
+}
+
+template <class SolverDict>
+std::size_t SolveStream<SolverDict>::columns() const {
+  return columns_;
+}
+
+template <class SolverDict> std::size_t SolveStream<SolverDict>::rows() const {
+  return numb_rows_;
+}
+
+template <class SolverDict>
+template <class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                           int>>
+void SolveStream<SolverDict>::push_row(const std::string_view row,
+                                       Sink&& sink) {
+  if (row.size() != columns_) {
+    throw std::runtime_error(fmt::format(
+        "Row has {} letters, stream has {} columns", row.size(), columns_));
+  }
+
+  const auto capacity = window_.rows();
+  const auto ring_row = numb_rows_ % capacity;
+  for (std::size_t x = 0; x < columns_; ++x) {
+    window_(ring_row, x) = row[x];
+  }
+  ++numb_rows_;
+  if (columns_ == 0 || max_length_ == 0) {
+    return;
+  }
+
+  const auto numb_window_rows = std::min(numb_rows_, capacity);
+  const auto first_row = numb_rows_ - numb_window_rows;
+  for (std::size_t age = 0; age < numb_window_rows; ++age) {
+    ring_rows_[age] = (first_row + age) % capacity;
+    ages_[ring_rows_[age]] = age;
+  }
+  std::fill(visited_.begin(), visited_.end(), 0);
+  const detail::RingVisited ring{visited_, ring_rows_, ages_, numb_window_rows,
+                                 columns_};
+
+  auto emit = [&](const std::string_view word, const Path path, const auto&) {
+    if (std::none_of(path.begin(), path.end(), [ring_row](const Index index) {
+          return index.y == ring_row;
+        })) {
+      return;
+    }
+    path_.clear();
+    for (const auto index : path) {
+      path_.push_back(Index{first_row + ages_[index.y], index.x});
+    }
+    sink(word, Path{path_});
+  };
+  detail::NoDonor donor;
+  const auto last_age = numb_window_rows - 1;
+  const auto rows_to_last = [this, last_age](const Index index) {
+    return last_age - ages_[index.y];
+  };
+  const auto search = [&](const auto visited) {
+    for (const auto y : ranges::span{ring_rows_.data(), numb_window_rows}) {
+      for (std::size_t x = 0; x < columns_; ++x) {
+        detail::search_task(
+            solver_dict_, window_, detail::SearchTask{{}, {Index{y, x}}, false},
+            emit, donor, workspace_,
+            detail::TowardsVisited{visited, rows_to_last, max_length_},
+            limits_);
+      }
+    }
+  };
+
+  if (neighbour_masks_.empty()) {
+    search(ring);
+    return;
+  }
+  // Small enough for a bitboard, with the neighbours of the window's rows
+  // as they are now in the ring
+  for (const auto y : ranges::span{ring_rows_.data(), numb_window_rows}) {
+    for (std::size_t x = 0; x < columns_; ++x) {
+      auto& mask = neighbour_masks_[y * columns_ + x];
+      mask = 0;
+      ring.for_each_unvisited_neighbour(Index{y, x}, [&](const Index index) {
+        mask |= std::uint64_t{1} << (index.y * columns_ + index.x);
+      });
+    }
+  }
+  std::uint64_t visited_bits = 0;
+  search(detail::BitboardVisited{visited_bits, neighbour_masks_, columns_});
+}
+
+} // namespace solver
+
+#endif // SOLVE_STREAM_TPP
@@ -3,10 +3,18 @@
 
 #include "matrix2d/matrix2d.hpp"
 #include "wordsearch_solver/config.hpp"
+#include "wordsearch_solver/solver/adjacency.hpp"
 
+#include <boost/container/static_vector.hpp>
 #include <range/v3/view/all.hpp>
+#include <range/v3/view/span.hpp>
 #include <range/v3/view/view.hpp>
 
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -35,10 +43,149 @@ using WordToListOfListsOfIndexes =
 // overloads on operator(), and std::equal_to<void> template args, the
 // std::unordered_map.find() templated version is c++20
 using WordsearchGrid = matrix2d::Matrix2d<char>;
+/** The indexes of a word's letters in the grid, in order, as handed to a sink.
+ * Only valid for the duration of the sink call.
+ */
+using Path = ranges::span<const Index>;
+
+template <class T, std::size_t N>
+// using static_vector = std::experimental::fixed_capacity_vector<T, N>;
+// llvm_small_vector
+using static_vector = boost::container::static_vector<T, N>;
+
+/** The lengths of words to find, inclusive */
+struct LengthLimits {
+  /** Shorter words are not output, though the search still passes through
+   * them on the way to longer ones
+   */
+  std::size_t min_length = 0;
+  /** The search never goes deeper than this */
+  std::size_t max_length = std::numeric_limits<std::size_t>::max();
+};
+
+template <class SolverDict> class SolverWorkspace;
+
+namespace detail {
+struct SearchTask;
+template <class SolverDict, class Emit, class Donor>
+void search_task(const SolverDict& solver_dict, const WordsearchGrid& grid,
+                 SearchTask task, Emit& emit, Donor& donor,
+                 SolverWorkspace<SolverDict>& workspace,
+                 LengthLimits limits = {});
+template <class SolverDict, class Emit, class Donor, class Visited>
+void search_task(const SolverDict& solver_dict, const WordsearchGrid& grid,
+                 SearchTask task, Emit& emit, Donor& donor,
+                 SolverWorkspace<SolverDict>& workspace, Visited visited,
+                 LengthLimits limits = {});
+
+/** Grids with at most this many cells are searched with a bitboard */
+inline constexpr std::size_t bitboard_max_cells = 64;
+} // namespace detail
+
+/** Scratch buffers the search uses, kept between searches to save allocating
+ * and zeroing them again for every start cell.
+ *
+ * solve() and the multithreaded solve() already keep one per thread. Pass one
+ * to solve_index() or solve() to also reuse it across calls, for example when
+ * solving many grids in a row.
+ *
+ * The cells marked as visited are always those on the current path, so a
+ * search starts by unmarking just those rather than clearing the whole grid.
+ * Grids of over 64 cells are searched in a copy of their letters with a border
+ * of sentinel cells around them, and a visited set with the same border always
+ * marked, so that each of a cell's neighbours is a constant offset away and
+ * needs no bounds checks. Paths are only turned back into indexes when a word
+ * is output. Grids of up to 64 cells are instead searched with the visited set
+ * as a single bitboard, and a precomputed bitboard of each cell's neighbours.
+ * A workspace is only reallocated when used with a grid of a new shape.
+ *
+ * Not thread safe, use one per thread.
+ */
+template <class SolverDict> class SolverWorkspace {
+  using Cursor = typename SolverDict::Cursor;
+
+  /** A cell in the grid, either an Index or a padded cell offset, and the
+   * dictionary's cursor for the path to it
+   */
+  template <class Cell> struct Step {
+    Cell cell;
+    Cursor cursor;
+  };
+  // Each layer is the cells adjacent to the previous layer's front that might
+  // lead to more words, its front is the one currently being explored
+  template <class Cell>
+  using Layers = std::vector<static_vector<Step<Cell>, 8>>;
+
+  Layers<Index> q_;
+  /** The current path, or for grids searched padded, the path turned back
+   * into indexes to output
+   */
+  Tail tail_;
+  std::string tail_string_;
+  /** Shape of the grid the buffers are sized for */
+  std::size_t rows_ = 0;
+  std::size_t columns_ = 0;
+  /** For grids too big for a bitboard, the layers and current path as padded
+   * cell offsets. Cell `(y, x)` is at `(y + 1) * (columns + 2) + x + 1`.
+   */
+  Layers<std::size_t> padded_q_;
+  std::vector<std::size_t> padded_path_;
+  /** For grids too big for a bitboard, the grid's letters by padded cell, with
+   * a border of `'\0'` around them. Filled by load().
+   */
+  std::vector<char> padded_letters_;
+  /** For grids too big for a bitboard, whether each cell is in padded_path_,
+   * by padded cell, with the border always set
+   */
+  std::vector<unsigned char> padded_tail_;
+  /** For grids that fit in a bitboard, bit `y * columns + x` is set for each
+   * cell in tail_
+   */
+  std::uint64_t tail_bits_ = 0;
+  /** For grids that fit in a bitboard, the bitboard of each cell's neighbours
+   */
+  std::vector<std::uint64_t> neighbours_;
+
+  template <class D, class Emit, class Donor>
+  friend void detail::search_task(const D& solver_dict,
+                                  const WordsearchGrid& grid,
+                                  detail::SearchTask task, Emit& emit,
+                                  Donor& donor, SolverWorkspace<D>& workspace,
+                                  LengthLimits limits);
+  template <class D, class Emit, class Donor, class Visited>
+  friend void detail::search_task(const D& solver_dict,
+                                  const WordsearchGrid& grid,
+                                  detail::SearchTask task, Emit& emit,
+                                  Donor& donor, SolverWorkspace<D>& workspace,
+                                  Visited visited, LengthLimits limits);
+
+  /** Empty the buffers ready to search @p grid */
+  void reset(const WordsearchGrid& grid);
+
+  /** The layers and path buffers for searches over cells of type @p Cell */
+  template <class Cell> Layers<Cell>& layers();
+  template <class Cell> std::vector<Cell>& path();
+
+public:
+  SolverWorkspace() = default;
+
+  /** Constructs a workspace with buffers already sized for and holding the
+   * letters of @p grid
+   */
+  explicit SolverWorkspace(const WordsearchGrid& grid);
+
+  /** Size the buffers for @p grid and copy in its letters. solve() and
+   * solve_index() do this to a workspace passed to them.
+   */
+  void load(const WordsearchGrid& grid);
+};
 
 /** Find all possible words using @p solver_dict that may start at @p
  * start_index in @p grid, and write them out to @p word_to_list_of_indexes
  *
+ * The search walks @p solver_dict one letter at a time, keeping a
+ * SolverDictWrapper::Cursor for each letter of the current path.
+ *
  * @param[in] solver_dict The solver dictionary implementation to use, for
  * example SolverDictWrapper
  * @param[in] grid The wordsearch matrix/grid to solve
@@ -51,6 +198,26 @@ void solve_index(const SolverDict& solver_dict, const WordsearchGrid& grid,
                  const Index start_index,
                  WordToListOfListsOfIndexes& word_to_list_of_indexes);
 
+/** @overload
+ * @param[in] sink Called as `sink(word, path)` with a `std::string_view` and a
+ * Path for every word found, instead of writing them to a map.
+ */
+template <class SolverDict, class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                           int> = 0>
+void solve_index(const SolverDict& solver_dict, const WordsearchGrid& grid,
+                 const Index start_index, Sink&& sink);
+
+/** @overload
+ * @param[in,out] workspace Scratch buffers to search with, see SolverWorkspace
+ */
+template <class SolverDict, class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                           int> = 0>
+void solve_index(const SolverDict& solver_dict, const WordsearchGrid& grid,
+                 const Index start_index, Sink&& sink,
+                 SolverWorkspace<SolverDict>& workspace);
+
 /** Runs solve_index() on every element of @p grid to solve the whole wordsearch
  * @param[in] solver_dict The solver dictionary implementation to use, for
  * example SolverDictWrapper
@@ -62,9 +229,293 @@ template <class SolverDict>
 WordToListOfListsOfIndexes solve(const SolverDict& solver_dict,
                                  const WordsearchGrid& grid);
 
+/** Like solve(), but hands each word found to @p sink rather than building a
+ * map of results.
+ *
+ * For every word found, calls `sink(word, path)` where `word` is a
+ * `std::string_view` and `path` is a Path of the indexes spelling it out. Both
+ * point into the solver's own buffers, so nothing is allocated per word, and
+ * they are only valid until @p sink returns. Copy them to keep them.
+ *
+ * Words are passed in the same order that solve() appends them to its lists
+ * of indexes, and a word found along several paths is passed once per path.
+ *
+ * @param[in] solver_dict The solver dictionary implementation to use, for
+ * example SolverDictWrapper
+ * @param[in] grid The wordsearch matrix/grid to solve
+ * @param[in] sink Callable taking `(std::string_view, Path)`
+ */
+template <class SolverDict, class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                           int> = 0>
+void solve(const SolverDict& solver_dict, const WordsearchGrid& grid,
+           Sink&& sink);
+
+/** @overload
+ * @param[in,out] workspace Scratch buffers to search with, see SolverWorkspace
+ */
+template <class SolverDict, class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                           int> = 0>
+void solve(const SolverDict& solver_dict, const WordsearchGrid& grid,
+           Sink&& sink, SolverWorkspace<SolverDict>& workspace);
+
+/** Like solve(), but only finds words with lengths within @p limits.
+ *
+ * Words shorter than `limits.min_length` are never output, and the search
+ * stops at `limits.max_length` letters rather than following prefixes of
+ * longer words. A dictionary built with the same maximum length, such as
+ * compact_trie::CompactTrie or compact_trie2::CompactTrie2 given one, also
+ * has none of these prefixes to follow.
+ *
+ * @param[in] solver_dict The solver dictionary implementation to use, for
+ * example SolverDictWrapper
+ * @param[in] grid The wordsearch matrix/grid to solve
+ * @param[in] limits The shortest and longest words to find
+ * @throws std::runtime_error If `limits.min_length > limits.max_length`
+ * @returns The map from words to lists of indexes that results are written out
+ * to
+ */
+template <class SolverDict>
+WordToListOfListsOfIndexes solve(const SolverDict& solver_dict,
+                                 const WordsearchGrid& grid,
+                                 LengthLimits limits);
+
+/** @overload
+ * @param[in] sink Callable taking `(std::string_view, Path)`, as for the sink
+ * overload of solve()
+ */
+template <class SolverDict, class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                           int> = 0>
+void solve(const SolverDict& solver_dict, const WordsearchGrid& grid,
+           LengthLimits limits, Sink&& sink);
+
+/** Like solve(), but paths step between the cells that @p adjacency says are
+ * next to each other, rather than any of the 8 cells around each. Removed
+ * cells are never part of a path.
+ *
+ * Grids of up to 64 cells are searched with a bitboard of each cell's
+ * neighbours from @p adjacency, others by following its lists of neighbours.
+ * solve() without an Adjacency keeps its own search, specialised for 8
+ * neighbours on a rectangle.
+ *
+ * @param[in] solver_dict The solver dictionary implementation to use, for
+ * example SolverDictWrapper
+ * @param[in] grid The wordsearch matrix/grid to solve
+ * @param[in] adjacency Which cells are next to which, the same shape as
+ * @p grid
+ * @throws std::runtime_error If @p adjacency is not the same shape as @p grid
+ * @returns The map from words to lists of indexes that results are written out
+ * to
+ */
+template <class SolverDict>
+WordToListOfListsOfIndexes solve(const SolverDict& solver_dict,
+                                 const WordsearchGrid& grid,
+                                 const Adjacency& adjacency);
+
+/** @overload
+ * @param[in] sink Callable taking `(std::string_view, Path)`, as for the sink
+ * overload of solve()
+ */
+template <class SolverDict, class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                           int> = 0>
+void solve(const SolverDict& solver_dict, const WordsearchGrid& grid,
+           const Adjacency& adjacency, Sink&& sink);
+
+/** Like the sink overload of solve(), but passes @p sink each word's id from
+ * `solver_dict.word_id()` rather than its text.
+ *
+ * Ids are dense, from 0 to `solver_dict.size() - 1`, so results can be kept in
+ * a flat vector indexed by id, with the words themselves fetched afterwards
+ * with `solver_dict.word()` if needed.
+ *
+ * @param[in] solver_dict The solver dictionary implementation to use, for
+ * example SolverDictWrapper
+ * @param[in] grid The wordsearch matrix/grid to solve
+ * @param[in] sink Callable taking `(std::size_t, Path)`
+ */
+template <class SolverDict, class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::size_t, Path>,
+                           int> = 0>
+void solve_word_ids(const SolverDict& solver_dict, const WordsearchGrid& grid,
+                    Sink&& sink);
+
+/** Like solve(), but for grids of exactly @p Rows x @p Cols, such as Boggle
+ * boards, with the search specialised at compile time for that size.
+ *
+ * Neighbours of each cell come from a `constexpr` table, the visited set is a
+ * single `uint64_t`, and the search's stack is a fixed size array as no path
+ * is longer than `Rows * Cols` cells. Nothing is allocated while searching.
+ *
+ * Results and their order are the same as solve()'s.
+ *
+ * @tparam Rows The number of rows @p grid must have
+ * @tparam Cols The number of columns @p grid must have, at most 64 cells in all
+ * @param[in] solver_dict The solver dictionary implementation to use, for
+ * example SolverDictWrapper
+ * @param[in] grid The wordsearch matrix/grid to solve
+ * @throws std::runtime_error If @p grid is not @p Rows x @p Cols
+ * @returns The map from words to lists of indexes that results are written out
+ * to
+ */
+template <std::size_t Rows, std::size_t Cols, class SolverDict>
+WordToListOfListsOfIndexes solve(const SolverDict& solver_dict,
+                                 const WordsearchGrid& grid);
+
+/** @overload
+ * @param[in] sink Callable taking `(std::string_view, Path)`, as for the sink
+ * overload of solve()
+ */
+template <std::size_t Rows, std::size_t Cols, class SolverDict, class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                           int> = 0>
+void solve(const SolverDict& solver_dict, const WordsearchGrid& grid,
+           Sink&& sink);
+
+/** How a multithreaded solve() shares the work out between threads */
+enum class Schedule {
+  /** Start cells are handed out to the workers in contiguous chunks. Cheap,
+   * but a few expensive cells can leave most workers idle at the end.
+   */
+  chunked,
+  /** Each worker starts with a block of start cells. Whenever a worker is idle
+   * and there's nothing to steal, busy workers split their search and give
+   * away the unexplored sibling branches closest to their start cell, so that
+   * the load balances even when one cell holds most of the work.
+   */
+  work_stealing,
+};
+
+/** Like solve(), but spreads the start cells of @p grid across @p numb_threads
+ * worker threads, using Schedule::chunked.
+ *
+ * Each chunk of cells gets its own result map, and these are merged in chunk
+ * order at the end, so the output is identical to the single threaded solve(),
+ * including the order of each word's list of indexes.
+ *
+ * @param[in] solver_dict The solver dictionary implementation to use. This is
+ * shared by all the workers, which only call its const member functions.
+ * @param[in] grid The wordsearch matrix/grid to solve
+ * @param[in] numb_threads Number of threads to use, if 0 then uses
+ * `std::thread::hardware_concurrency()`
+ * @returns The map from words to lists of indexes that results are written out
+ * to
+ */
+template <class SolverDict>
+WordToListOfListsOfIndexes solve(const SolverDict& solver_dict,
+                                 const WordsearchGrid& grid,
+                                 std::size_t numb_threads);
+
+/** @overload
+ * @param[in] schedule How to share the work out between the threads. Whichever
+ * is used the output is identical to the single threaded solve().
+ */
+template <class SolverDict>
+WordToListOfListsOfIndexes solve(const SolverDict& solver_dict,
+                                 const WordsearchGrid& grid,
+                                 std::size_t numb_threads, Schedule schedule);
+
+/** What evaluate_boards() found on one board */
+struct BoardStats {
+  /** The number of different words */
+  std::size_t numb_words = 0;
+  /** The number of paths spelling any word, so a word found along several
+   * paths is counted once for each
+   */
+  std::size_t numb_paths = 0;
+  /** The length of the longest word, 0 if there are none */
+  std::size_t longest_word = 0;
+};
+
+/** Solve many boards of the same size with one dictionary, and count what is
+ * found on each, for example to pick the best of many random boards.
+ *
+ * Cheaper per board than calling solve() on each. Boards are read straight
+ * out of @p boards rather than built with make_grid(), no map of results is
+ * built, and each thread reuses one grid, one SolverWorkspace and one table of
+ * which words it has seen for all the boards it solves. Words are counted by
+ * `solver_dict.word_id()`, so no strings are made either.
+ *
+ * @param[in] solver_dict The solver dictionary implementation to use, for
+ * example SolverDictWrapper
+ * @param[in] boards The boards back to back, each @p rows x @p columns chars in
+ * row major order
+ * @param[in] rows The number of rows in each board
+ * @param[in] columns The number of columns in each board
+ * @param[in] numb_threads Number of threads to use, if 0 then uses
+ * `std::thread::hardware_concurrency()`
+ * @throws std::runtime_error If @p boards is not a whole number of boards
+ * @returns What was found on each board, in the same order as @p boards
+ */
+template <class SolverDict>
+std::vector<BoardStats>
+evaluate_boards(const SolverDict& solver_dict, std::string_view boards,
+                std::size_t rows, std::size_t columns,
+                std::size_t numb_threads = 0);
+
 /** Helper function to construct a `WordsearchGrid` */
 WordsearchGrid make_grid(const std::vector<std::string>& lines);
 
+namespace detail {
+/** Sort each word's lists of indexes into the order solve()'s depth first
+ * search would have found them in, for results gathered some other way
+ */
+void sort_as_solved(WordToListOfListsOfIndexes& word_to_list_of_indexes);
+
+/** @throws std::runtime_error If `limits.min_length > limits.max_length` */
+void throw_if_invalid(LengthLimits limits);
+} // namespace detail
+
+/** Which pairs of letters are next to each other somewhere in a grid, in any
+ * of the 8 directions.
+ *
+ * A word can only be in the grid if every pair of consecutive letters in it
+ * is, see prune().
+ */
+class AdjacentLetters {
+  /** Bit `b` of `pairs_[a]` is set if `b` is next to `a` anywhere */
+  std::vector<std::bitset<256>> pairs_;
+
+public:
+  explicit AdjacentLetters(const WordsearchGrid& grid);
+
+  /** Checks if @p b is next to @p a anywhere in the grid */
+  bool contains(char a, char b) const;
+};
+
+/** Builds a dictionary of the same type as @p solver_dict, holding only the
+ * words that could be in @p grid.
+ *
+ * A word is kept if the grid has at least as many of each of its letters as
+ * the word does, which also means it is no longer than the grid has cells,
+ * and if each pair of consecutive letters in it is in AdjacentLetters.
+ * solve() gives the same results with the pruned dictionary as with
+ * @p solver_dict, but searches a much smaller one when the grid is small or
+ * has few distinct letters. Worth it when one big dictionary is used to solve
+ * many small grids.
+ *
+ * Only the parts of @p solver_dict that the grid's letters can reach are
+ * walked, so this is usually much quicker than building @p solver_dict was.
+ * Subtrees that need a pair of letters never next to each other in the grid
+ * are not walked at all, and are left out of the pruned dictionary, so the
+ * search of the grid then never enters them either.
+ *
+ * @note Word ids of the pruned dictionary are not those of @p solver_dict
+ *
+ * @param[in] solver_dict The dictionary to prune
+ * @param[in] grid The wordsearch matrix/grid it will be used to solve
+ * @returns The pruned dictionary
+ */
+template <class SolverDict>
+SolverDict prune(const SolverDict& solver_dict, const WordsearchGrid& grid);
+
+namespace detail {
+template <class... SolverDicts>
+using CursorVariant = std::variant<typename SolverDicts::Cursor...>;
+} // namespace detail
+
 /** A type erased wrapper around a particular solver dictionary implementation.
  * Instances of this should be constructed by SolverDictFactory::make()
  *
@@ -76,21 +527,44 @@ class SolverDictWrapper {
   std::variant<WORDSEARCH_DICTIONARY_CLASSES> t_;
   static_assert(std::is_move_constructible_v<decltype(t_)>);
 
-  template <class Func> auto run(Func&& func) const;
-
 public:
+  /** An opaque position in the dictionary, standing for the prefix spelt out
+   * by the chars passed to child() to reach it from root().
+   *
+   * Cursors are cheap to copy, hold no state shared with other cursors and are
+   * only valid for the dictionary that made them. Walking a word one letter at
+   * a time from a parent cursor costs one step per letter, rather than
+   * searching for the whole prefix again as contains_further() must.
+   */
+  using Cursor = detail::CursorVariant<WORDSEARCH_DICTIONARY_CLASSES>;
+
   template <class SolverDict, class Words>
   SolverDictWrapper(const SolverDict& solver_dict, Words&& words);
 
   SolverDictWrapper(SolverDictWrapper&&) = default;
   SolverDictWrapper& operator=(SolverDictWrapper&&) = default;
 
+  /** Calls @p func with the dictionary implementation this wraps, as its own
+   * type, and returns what it returns.
+   *
+   * Every other member function visits the variant on each call. The solve
+   * functions given a SolverDictWrapper use this to visit it once, then search
+   * with the wrapped dictionary directly.
+   */
+  template <class Func> decltype(auto) visit(Func&& func) const;
+
   /** The number of whole words in this dictionary */
   std::size_t size() const;
 
   /** Checks if this dictionary is empty */
   bool empty() const;
 
+  /** The length of the longest word in this dictionary, or 0 if it's empty.
+   *
+   * Recorded when the dictionary is built, so this is O(1).
+   */
+  std::size_t max_word_length() const;
+
   /** Check if this dictionary contains @p word
    *
    * @param[in] word The word to check
@@ -112,6 +586,45 @@ public:
    */
   bool further(const std::string_view word) const;
 
+  /** @returns The cursor for the empty prefix */
+  Cursor root() const;
+
+  /** Step from @p cursor to the prefix one letter longer.
+   *
+   * @param[in] cursor The current prefix
+   * @param[in] c The letter to append to it
+   * @returns The cursor for @p cursor's prefix followed by @p c, or an empty
+   * `std::optional` if no word in this dictionary starts with that.
+   */
+  std::optional<Cursor> child(const Cursor& cursor, char c) const;
+
+  /** @returns `true` if @p cursor's prefix is a word in this dictionary */
+  bool is_word(const Cursor& cursor) const;
+
+  /** Like further(), but for the prefix of @p cursor
+   *
+   * @returns `false` if there are no more words in this dictionary with @p
+   * cursor's prefix as a proper prefix. Unlike further(), this is exact for
+   * all dictionary implementations.
+   */
+  bool has_further(const Cursor& cursor) const;
+
+  /** The id of the word @p cursor is at, for keying results by integer rather
+   * than by string.
+   *
+   * Ids are dense, from 0 to size() - 1, and ordered the same as the words
+   * themselves when sorted.
+   *
+   * @param[in] cursor Must be a word, ie. is_word() is `true`
+   */
+  std::size_t word_id(const Cursor& cursor) const;
+
+  /** The word with id @p id, the reverse of word_id()
+   *
+   * @throws std::out_of_range If @p id is not less than size()
+   */
+  std::string word(std::size_t id) const;
+
   /** For each char in suffix appended to stem, check whether this dictionary
    * contains this word and if it may contain longer words with this prefix.
    *
@@ -119,8 +632,9 @@ public:
    * @param[in] suffixes
    * @param[out] contains_further_it
    *
-   * This function is what the solver algorithm calls every iteration to ask the
-   * dictionary solver implementation to do its work.
+   * This was what the solver algorithm called every iteration to ask the
+   * dictionary solver implementation to do its work, it now walks Cursor s
+   * instead.
    *
    * @p contains_further_it should be assigned to and incremented like an
    * output iterator. The value written should be a std::pair<bool, bool>.
@@ -154,6 +668,12 @@ public:
 static_assert(std::is_move_constructible_v<SolverDictWrapper>);
 static_assert(std::is_move_assignable_v<SolverDictWrapper>);
 
+/** @overload
+ * The pruned dictionary wraps the same implementation as @p solver_dict
+ */
+SolverDictWrapper prune(const SolverDictWrapper& solver_dict,
+                        const WordsearchGrid& grid);
+
 /** This class can be used to check if a particular dictionary solver
  * implementation exists, and create an instance of one with a particular
  * dictionary.
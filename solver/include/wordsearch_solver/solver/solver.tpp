@@ -2,7 +2,7 @@
 #define SOLVER_TPP
 
 #include "matrix2d/matrix2d.hpp"
-#include "wordsearch_solver/wordsearch_solver.hpp"
+#include "wordsearch_solver/solver/solver.hpp"
 
 // #ifndef __EMSCRIPTEN__
 // #include <gperftools/profiler.h>
@@ -32,19 +32,27 @@
 #include <fmt/ranges.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <functional>
+#include <future>
 #include <initializer_list>
 #include <iostream>
 #include <iterator>
+#include <mutex>
+#include <optional>
 #include <ostream>
 #include <range/v3/view/zip.hpp>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
@@ -61,55 +69,445 @@
 
 namespace solver {
 
-template <class T, std::size_t N>
-// using static_vector = std::experimental::fixed_capacity_vector<T, N>;
-// llvm_small_vector
-using static_vector = boost::container::static_vector<T, N>;
+template <class SolverDict>
+SolverWorkspace<SolverDict>::SolverWorkspace(const WordsearchGrid& grid) {
+  this->load(grid);
+}
 
 template <class SolverDict>
-// std::unordered_map<std::string,
-// std::vector<std::vector<matrix2d::Index>>> Would like to express this
-// returns something with an interface like the above type. Perhaps just into
-// OutputIterator template type to avoid this altogether? (Need co_yield
-// really).
-void solve_index(const SolverDict& solver_dict, const WordsearchGrid& grid,
-                 const Index start_index,
-                 WordToListOfListsOfIndexes& word_to_list_of_indexes) {
-  // Coroutines in cppcoro needs libc++, ballache
-  // Folly coroutines unclear if need it
-  // Going to try boost coroutine2 for now at least as already installed
+void SolverWorkspace<SolverDict>::load(const WordsearchGrid& grid) {
+  this->reset(grid);
+  if (grid.size() > detail::bitboard_max_cells) {
+    const auto padded_cols = columns_ + 2;
+    padded_letters_.assign((rows_ + 2) * padded_cols, '\0');
+    for (std::size_t y = 0; y < rows_; ++y) {
+      for (std::size_t x = 0; x < columns_; ++x) {
+        padded_letters_[(y + 1) * padded_cols + x + 1] = grid(y, x);
+      }
+    }
+  }
+}
 
-  // Unsure if necessary
-  if (grid.empty()) {
-    return;
+template <class SolverDict>
+template <class Cell>
+auto SolverWorkspace<SolverDict>::layers() -> Layers<Cell>& {
+  if constexpr (std::is_same_v<Cell, Index>) {
+    return q_;
+  } else {
+    return padded_q_;
   }
+}
 
-  if (start_index.y > grid.rows() || start_index.x > grid.columns()) {
-    throw std::runtime_error("Start index out of range of wordsearch grid");
+template <class SolverDict>
+template <class Cell>
+std::vector<Cell>& SolverWorkspace<SolverDict>::path() {
+  if constexpr (std::is_same_v<Cell, Index>) {
+    return tail_;
+  } else {
+    return padded_path_;
+  }
+}
+
+template <class SolverDict>
+void SolverWorkspace<SolverDict>::reset(const WordsearchGrid& grid) {
+  const auto rows = grid.rows();
+  const auto cols = grid.columns();
+  if (rows_ != rows || columns_ != cols) {
+    rows_ = rows;
+    columns_ = cols;
+    neighbours_.clear();
+    if (grid.size() <= detail::bitboard_max_cells) {
+      // Neighbours in the same order as the bits, NW, N, NE, W, E, SW, S, SE
+      for (std::size_t y = 0; y < rows; ++y) {
+        for (std::size_t x = 0; x < cols; ++x) {
+          std::uint64_t neighbours = 0;
+          for (auto ny = y > 0 ? y - 1 : y; ny <= y + 1 && ny < rows; ++ny) {
+            for (auto nx = x > 0 ? x - 1 : x; nx <= x + 1 && nx < cols; ++nx) {
+              if (ny != y || nx != x) {
+                neighbours |= std::uint64_t{1} << (ny * cols + nx);
+              }
+            }
+          }
+          neighbours_.push_back(neighbours);
+        }
+      }
+    } else {
+      // The border is marked as visited so the search never steps onto it
+      const auto padded_cols = cols + 2;
+      padded_tail_.assign((rows + 2) * padded_cols, 1);
+      for (std::size_t y = 1; y <= rows; ++y) {
+        std::fill_n(padded_tail_.data() + y * padded_cols + 1, cols, 0);
+      }
+    }
+  } else if (grid.size() > detail::bitboard_max_cells) {
+    // Only the cells on the last search's path can still be marked, this holds
+    // even if that search was left part way by an exception
+    for (const auto cell : padded_path_) {
+      padded_tail_[cell] = 0;
+    }
+  }
+  tail_bits_ = 0;
+  q_.clear();
+  tail_.clear();
+  padded_q_.clear();
+  padded_path_.clear();
+  tail_string_.clear();
+  // Words are passed to emit by briefly appending to the path and tail_string,
+  // no path is longer than the grid so this avoids reallocating while searching
+  tail_.reserve(grid.size());
+  padded_path_.reserve(grid.size());
+  tail_string_.reserve(grid.size());
+}
+
+namespace detail {
+
+/** A subtree of the search for solve_index() to explore.
+ *
+ * This is every path that starts with @p prefix followed by one of the indexes
+ * in @p layer.
+ */
+struct SearchTask {
+  /** Path leading up to @p layer, empty for a start cell */
+  Tail prefix;
+  /** Sibling indexes adjacent to the end of @p prefix, in search order */
+  static_vector<Index, 8> layer;
+  /** Whether the dictionary has already been asked about @p layer, and said
+   * that it may contain longer words starting with each of them.
+   * Words ending at @p layer have then already been output.
+   */
+  bool layer_checked;
+};
+
+/** Index of the lowest set bit of @p bits, which must not be 0 */
+inline unsigned count_trailing_zeros(const std::uint64_t bits) {
+  assert(bits != 0);
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<unsigned>(__builtin_ctzll(bits));
+#else
+  unsigned n = 0;
+  for (auto b = bits; (b & 1) == 0; b >>= 1) {
+    ++n;
+  }
+  return n;
+#endif
+}
+
+/** Visited set for search_task() for any size of grid, over padded cells.
+ *
+ * Cell `(y, x)` is at `(y + 1) * (cols + 2) + x + 1` in both the visited set
+ * and the letters, which have a border of cells around the grid. The border is
+ * always visited, so each of a cell's neighbours is a fixed offset away from it
+ * and none need bounds checking. The search then steps between these cells
+ * directly, and only turns them back into an Index to output a path.
+ */
+class PaddedVisited {
+  std::vector<unsigned char>& visited_;
+  const std::vector<char>& letters_;
+  std::size_t padded_cols_;
+  /** Offset from a cell to each of its neighbours, steps back are stored
+   * wrapped around, as unsigned addition wraps back to the right answer
+   */
+  std::array<std::size_t, 8> offsets_;
+
+public:
+  using Cell = std::size_t;
+
+  PaddedVisited(std::vector<unsigned char>& visited,
+                const std::vector<char>& letters, const std::size_t cols)
+      : visited_(visited), letters_(letters), padded_cols_(cols + 2) {
+    assert(visited_.size() == letters_.size());
+    // Order in which we access adjacent values, eg. SW = SouthWest = {+1, -1}
+    // NW, N, NE, W, E, SW, S, SE
+    const auto back = static_cast<std::size_t>(-1);
+    auto offset = offsets_.begin();
+    for (const auto dy : {back, std::size_t{0}, std::size_t{1}}) {
+      for (const auto dx : {back, std::size_t{0}, std::size_t{1}}) {
+        if (dy != 0 || dx != 0) {
+          *offset++ = dy * padded_cols_ + dx;
+        }
+      }
+    }
+  }
+
+  Cell cell(const Index index) const {
+    return (index.y + 1) * padded_cols_ + index.x + 1;
   }
+  Index index(const Cell cell) const {
+    return Index{cell / padded_cols_ - 1, cell % padded_cols_ - 1};
+  }
+  char letter(const Cell cell) const { return letters_[cell]; }
+
+  bool contains(const Cell cell) const { return visited_[cell]; }
+  void insert(const Cell cell) { visited_[cell] = 1; }
+  void erase(const Cell cell) { visited_[cell] = 0; }
+
+  /** Calls @p func with each cell adjacent to @p n not in the set */
+  template <class Func>
+  void for_each_unvisited_neighbour(const Cell n, Func&& func) const {
+    for (const auto offset : offsets_) {
+      if (!visited_[n + offset]) {
+        func(n + offset);
+      }
+    }
+  }
+};
+
+/** Visited set for search_task() as a bitboard, with bit `y * cols + x` set
+ * for each visited cell, for grids of at most bitboard_max_cells cells
+ */
+struct BitboardVisited {
+  std::uint64_t& visited;
+  /** Bitboard of each cell's neighbours */
+  const std::vector<std::uint64_t>& neighbours;
+  std::size_t cols;
+
+  using Cell = Index;
+  Cell cell(const Index index) const { return index; }
+  Index index(const Cell cell) const { return cell; }
+
+  std::uint64_t bit(const Index index) const {
+    return std::uint64_t{1} << (index.y * cols + index.x);
+  }
+  bool contains(const Index index) const { return visited & bit(index); }
+  void insert(const Index index) { visited |= bit(index); }
+  void erase(const Index index) { visited &= ~bit(index); }
+
+  /** Calls @p func with each index adjacent to @p n not in the set */
+  template <class Func>
+  void for_each_unvisited_neighbour(const Index n, Func&& func) const {
+    // Lowest bit first is the same NW to SE order as PaddedVisited
+    for (auto candidates = neighbours[n.y * cols + n.x] & ~visited;
+         candidates != 0; candidates &= candidates - 1) {
+      const std::size_t cell = count_trailing_zeros(candidates);
+      func(Index{cell / cols, cell % cols});
+    }
+  }
+};
+
+/** Visited set for search_task() over an Adjacency, with one entry per cell
+ * `y * cols + x`
+ */
+struct GraphVisited {
+  std::vector<unsigned char>& visited;
+  const Adjacency& adjacency;
+  std::size_t cols;
+
+  using Cell = Index;
+  Cell cell(const Index index) const { return index; }
+  Index index(const Cell cell) const { return cell; }
+
+  bool contains(const Index index) const {
+    return visited[index.y * cols + index.x];
+  }
+  void insert(const Index index) { visited[index.y * cols + index.x] = 1; }
+  void erase(const Index index) { visited[index.y * cols + index.x] = 0; }
+
+  /** Calls @p func with each index adjacent to @p n not in the set */
+  template <class Func>
+  void for_each_unvisited_neighbour(const Index n, Func&& func) const {
+    for (const auto cell : adjacency.neighbours(n.y * cols + n.x)) {
+      if (!visited[cell]) {
+        func(Index{cell / cols, cell % cols});
+      }
+    }
+  }
+};
+
+/** Wraps another visited set for search_task(), to only step to neighbours
+ * from which a path no longer than @p max_length could still reach a target
+ * set of cells, until one of them has been visited.
+ *
+ * `distance(index)` is the fewest steps from `index` to any target cell, or
+ * 0 if it is one. The number of cells visited is the length of the current
+ * path, as removed cells are marked in the wrapped set beforehand rather than
+ * through this.
+ */
+template <class Visited, class Distance> class TowardsVisited {
+  Visited visited_;
+  Distance distance_;
+  std::size_t max_length_;
+  std::size_t numb_visited_ = 0;
+  std::size_t numb_targets_visited_ = 0;
+
+public:
+  TowardsVisited(Visited visited, Distance distance,
+                 const std::size_t max_length)
+      : visited_(std::move(visited)), distance_(std::move(distance)),
+        max_length_(max_length) {}
+
+  using Cell = typename Visited::Cell;
+  static_assert(std::is_same_v<Cell, Index>, "Distance takes an Index");
+  Cell cell(const Index index) const { return index; }
+  Index index(const Cell cell) const { return cell; }
+
+  bool contains(const Index index) const { return visited_.contains(index); }
+  void insert(const Index index) {
+    visited_.insert(index);
+    ++numb_visited_;
+    numb_targets_visited_ += distance_(index) == 0;
+  }
+  void erase(const Index index) {
+    visited_.erase(index);
+    --numb_visited_;
+    numb_targets_visited_ -= distance_(index) == 0;
+  }
+
+  /** Calls @p func with each index adjacent to @p n not in the set, from
+   * which a target can still be reached
+   */
+  template <class Func>
+  void for_each_unvisited_neighbour(const Index n, Func&& func) const {
+    visited_.for_each_unvisited_neighbour(n, [&](const Index index) {
+      if (numb_targets_visited_ > 0 ||
+          numb_visited_ + 1 + distance_(index) <= max_length_) {
+        func(index);
+      }
+    });
+  }
+};
+
+/** Length of the longest word in @p solver_dict that @p limits allows */
+template <class SolverDict>
+std::size_t max_word_length(const SolverDict& solver_dict,
+                            const LengthLimits limits) {
+  return std::min(solver_dict.max_word_length(), limits.max_length);
+}
+
+/** Detects an emit for search_task() with a `wants(cursor)` member */
+template <class Emit, class Cursor, class = void>
+struct has_wants : std::false_type {};
+template <class Emit, class Cursor>
+struct has_wants<Emit, Cursor,
+                 std::void_t<decltype(std::declval<Emit&>().wants(
+                     std::declval<const Cursor&>()))>> : std::true_type {};
+
+/** Whether search_task() should build the word and path for @p cursor and pass
+ * them to @p emit. An emit with a `wants(cursor)` member may turn down words it
+ * would make nothing of, any other is passed every word.
+ */
+template <class Emit, class Cursor>
+bool emit_wants(Emit& emit, const Cursor& cursor) {
+  if constexpr (has_wants<Emit, Cursor>::value) {
+    return emit.wants(cursor);
+  } else {
+    return true;
+  }
+}
+
+/** Donor for search_task() that never gives work away */
+struct NoDonor {
+  constexpr bool wants_work() const { return false; }
+  void give(SearchTask&&) {}
+};
+
+/** Run the depth first search over @p task, passing each word found, its path
+ * and the dictionary's cursor for it to @p emit, unless emit_wants() says not
+ * to. Searches in the buffers of
+ * @p workspace, which must already be loaded with @p grid.
+ *
+ * Every iteration, if @p donor.wants_work(), the unexplored siblings in the
+ * shallowest layer that has any are handed to @p donor.give() as a new task
+ * and removed from this search.
+ */
+template <class SolverDict, class Emit, class Donor>
+void search_task(const SolverDict& solver_dict, const WordsearchGrid& grid,
+                 SearchTask task, Emit& emit, Donor& donor,
+                 SolverWorkspace<SolverDict>& workspace,
+                 const LengthLimits limits) {
+  if (grid.size() <= bitboard_max_cells) {
+    search_task(solver_dict, grid, std::move(task), emit, donor, workspace,
+                BitboardVisited{workspace.tail_bits_, workspace.neighbours_,
+                                grid.columns()},
+                limits);
+  } else {
+    assert(workspace.padded_letters_.size() ==
+           (grid.rows() + 2) * (grid.columns() + 2));
+    search_task(solver_dict, grid, std::move(task), emit, donor, workspace,
+                PaddedVisited{workspace.padded_tail_, workspace.padded_letters_,
+                              grid.columns()},
+                limits);
+  }
+}
+
+/** search_task(), keeping the cells on the current path in @p visited, which
+ * may also hold cells the search must never step onto.
+ *
+ * The search steps between cells of type `Visited::Cell`, as given by
+ * @p visited, which converts them to and from an Index.
+ */
+template <class SolverDict, class Emit, class Donor, class Visited>
+void search_task(const SolverDict& solver_dict, const WordsearchGrid& grid,
+                 SearchTask task, Emit& emit, Donor& donor,
+                 SolverWorkspace<SolverDict>& workspace, Visited visited,
+                 const LengthLimits limits) {
+  workspace.reset(grid);
+
+  // Coroutines in cppcoro needs libc++, ballache
+  // Folly coroutines unclear if need it
+  // Going to try boost coroutine2 for now at least as already installed
+
+  assert(!grid.empty());
+  assert(!task.layer.empty());
 
 #define LOG(...)
   // #define LOG fmt::print
 
-  const auto rows = grid.rows();
-  const auto cols = grid.columns();
+  // Only used by LOG and assertions now neighbours come from visited
+  [[maybe_unused]] const auto rows = grid.rows();
+  [[maybe_unused]] const auto cols = grid.columns();
 
   // using boost::container::static_vector;
 
   LOG("Grid {}\n", grid);
   LOG("rows x cols = {} * {}\n", rows, cols);
-  LOG("Start index: {}", start_index);
+  LOG("Task: {} then {}", task.prefix, task.layer);
+
+  using Cell = typename Visited::Cell;
+  using Cursor = typename SolverDict::Cursor;
+  using Step = typename SolverWorkspace<SolverDict>::template Step<Cell>;
+  constexpr bool index_cells = std::is_same_v<Cell, Index>;
+
+  const auto cell_to_char = [&](const Cell cell) {
+    if constexpr (index_cells) {
+      return grid(cell);
+    } else {
+      return visited.letter(cell);
+    }
+  };
 
-  const auto index_to_char = [&grid](const auto index) { return grid(index); };
+  auto& q = workspace.template layers<Cell>();
+  auto& tail = workspace.template path<Cell>();
+  auto& tail_string = workspace.tail_string_;
 
-  std::vector<static_vector<Index, 8>> q;
+  // The path as indexes, to output. Only a copy of it if cells aren't indexes.
+  const auto tail_indexes = [&]() -> const Tail& {
+    if constexpr (index_cells) {
+      return tail;
+    } else {
+      auto& indexes = workspace.tail_;
+      indexes.clear();
+      for (const auto cell : tail) {
+        indexes.push_back(visited.index(cell));
+      }
+      return indexes;
+    }
+  };
 
-  static_vector<Index, 8> suffixes{start_index};
-  std::string suffixes_string{index_to_char(start_index)};
+  static_vector<Cell, 8> suffixes;
+  std::string suffixes_string;
 
-  Tail tail;
-  std::string tail_string;
-  matrix2d::Matrix2d<bool> tail_matrix{grid.rows(), grid.columns()};
+  for (const auto index : task.prefix) {
+    tail.push_back(visited.cell(index));
+  }
+  const auto prefix_size = tail.size();
+  Cursor prefix_cursor = solver_dict.root();
+  for (const auto cell : tail) {
+    tail_string.push_back(cell_to_char(cell));
+    visited.insert(cell);
+    const auto child = solver_dict.child(prefix_cursor, cell_to_char(cell));
+    assert(child);
+    prefix_cursor = *child;
+  }
 
   const auto assert_invariants = [&]() {
 #if 0
@@ -119,28 +517,58 @@ void solve_index(const SolverDict& solver_dict, const WordsearchGrid& grid,
     // this work with conan?
     const auto q_fronts = ranges::views::transform(q, [](const auto &indexes) {
       assert(!indexes.empty());
-      return indexes.front();
+      return indexes.front().cell;
     });
     const auto q_fronts_string =
-        ranges::views::transform(q_fronts, index_to_char);
+        ranges::views::transform(q_fronts, cell_to_char);
     assert(ranges::all_of(
         q, [](const auto &indexes) { return !indexes.empty(); }));
-    assert(ranges::equal(ranges::views::transform(suffixes, index_to_char),
+    assert(ranges::equal(ranges::views::transform(suffixes, cell_to_char),
                          suffixes_string));
 
-    assert(ranges::equal(ranges::views::transform(tail, index_to_char),
+    assert(ranges::equal(ranges::views::transform(tail, cell_to_char),
                          tail_string));
 
-    const auto rows = tail_matrix.rows_iter();
-    for (const auto &[i, row] : ranges::views::enumerate(rows)) {
-      for (const auto j : ranges::views::ints(0UL, row.size())) {
-        assert(ranges::contains(tail, Index{i, j}) == tail_matrix(i, j));
-        (void)j;
+    for (const auto i : ranges::views::ints(0UL, rows)) {
+      for (const auto j : ranges::views::ints(0UL, cols)) {
+        assert(ranges::contains(tail, visited.cell(Index{i, j})) ==
+               visited.contains(visited.cell(Index{i, j})));
       }
     }
 #endif
   };
 
+  // Replace suffixes with the cells adjacent to n not already in the tail
+  const auto set_suffixes = [&](const Cell n) {
+    suffixes.clear();
+    suffixes_string.clear();
+    visited.for_each_unvisited_neighbour(n, [&](const Cell cell) {
+      suffixes.push_back(cell);
+      suffixes_string.push_back(cell_to_char(cell));
+    });
+  };
+
+  if (task.layer_checked) {
+    q.emplace_back();
+    for (const auto index : task.layer) {
+      const auto cell = visited.cell(index);
+      const auto child = solver_dict.child(prefix_cursor, cell_to_char(cell));
+      assert(child);
+      q.back().push_back(Step{cell, *child});
+    }
+    const auto front = q.back().front().cell;
+    tail.push_back(front);
+    tail_string.push_back(cell_to_char(front));
+    visited.insert(front);
+    set_suffixes(front);
+  } else {
+    for (const auto index : task.layer) {
+      const auto cell = visited.cell(index);
+      suffixes.push_back(cell);
+      suffixes_string.push_back(cell_to_char(cell));
+    }
+  }
+
   while (true) {
 
     assert_invariants();
@@ -152,57 +580,51 @@ void solve_index(const SolverDict& solver_dict, const WordsearchGrid& grid,
     LOG("Suffixes: {}\n", suffixes);
     LOG("suffixes_string: {}\n", suffixes_string);
 
-    static_vector<std::pair<bool, bool>, 8> contains_further;
-
-    // const auto contains_further_start_time = now();
-    // ProfilerDisable();
-    solver_dict.contains_further(tail_string, suffixes_string,
-                                 std::back_inserter(contains_further));
-    // ProfilerEnable();
-    // time_spent_in_contains_further += now() - contains_further_start_time;
-
-    LOG("contains_further: {}\n", contains_further);
+    // Only empty when starting from a task whose layer is unchecked
+    const Cursor& tail_cursor =
+        q.empty() ? prefix_cursor : q.back().front().cursor;
 
     assert(suffixes.size() == suffixes_string.size());
-    assert(suffixes.size() == contains_further.size());
 
-    static_vector<Index, 8> next_layer;
+    // Length of the words found with each of the suffixes
+    const auto length = tail.size() + 1;
+    static_vector<Step, 8> next_layer;
     for (const auto i : ranges::views::ints(0UL, suffixes.size())) {
-      const auto [contains, further] = contains_further[i];
+      const auto child = solver_dict.child(tail_cursor, suffixes_string[i]);
+      if (!child) {
+        continue;
+      }
+      const auto contains =
+          length >= limits.min_length && solver_dict.is_word(*child);
+      const auto further =
+          length < limits.max_length && solver_dict.has_further(*child);
       LOG("For index in suffixes {}: {}/{}\n", i, suffixes[i],
           suffixes_string[i]);
       LOG("contains, further {} {}\n", contains, further);
-      if (contains) {
-        // Note, potential optim here. If can lookup by temporarily adding to
-        // tail, avoid allocation in case where key already exists in map.
-        LOG("Outputing word, indexes: {}, {}\n", word, indexes);
-        // Waiting for co_yield to output neatly from here...
-
+      if (contains && emit_wants(emit, *child)) {
         assert_invariants();
 
-        const auto suffix = suffixes[i];
-        const auto suffix_char = suffixes_string[i];
-
-        auto indexes = tail;
-        indexes.push_back(suffix);
-
-        word_to_list_of_indexes[tail_string + suffix_char].emplace_back(
-            std::move(indexes));
+        tail.push_back(suffixes[i]);
+        tail_string.push_back(suffixes_string[i]);
+        LOG("Outputing word, indexes: {}, {}\n", tail_string, tail);
+        emit(std::string_view{tail_string}, Path{tail_indexes()}, *child);
+        tail.pop_back();
+        tail_string.pop_back();
 
         assert_invariants();
       }
       if (further) {
         LOG("Adding to next_layer {}\n", suffixes[i]);
-        next_layer.push_back(suffixes[i]);
+        next_layer.push_back(Step{suffixes[i], *child});
       }
     }
 
     if (!next_layer.empty()) {
-      LOG("Appending to q next_layer: {}\n", next_layer);
-      q.push_back(next_layer);
-      tail.push_back(next_layer.front());
-      tail_string.push_back(index_to_char(next_layer.front()));
-      tail_matrix(next_layer.front()) = true;
+      const auto front = next_layer.front().cell;
+      q.push_back(std::move(next_layer));
+      tail.push_back(front);
+      tail_string.push_back(cell_to_char(front));
+      visited.insert(front);
     } else {
       for (; !q.empty() && q.back().size() <= 1;) {
         ////assert_invariants();
@@ -211,7 +633,7 @@ void solve_index(const SolverDict& solver_dict, const WordsearchGrid& grid,
         const auto index = tail.back();
         tail.pop_back();
         tail_string.pop_back();
-        tail_matrix(index) = false;
+        visited.erase(index);
         ////assert_invariants();
       }
 
@@ -221,14 +643,14 @@ void solve_index(const SolverDict& solver_dict, const WordsearchGrid& grid,
         LOG("Removing from front of back of q: {}\n", q.back().front());
         // assert(q.back().size() >= 2);
 
-        const auto index_to_remove = q.back()[0];
-        const auto index_to_add = q.back()[1];
+        const auto cell_to_remove = q.back()[0].cell;
+        const auto cell_to_add = q.back()[1].cell;
 
         q.back().erase(q.back().begin()); // Pop front
-        tail.back() = index_to_add;
-        tail_string.back() = index_to_char(index_to_add);
-        tail_matrix(index_to_remove) = false;
-        tail_matrix(index_to_add) = true;
+        tail.back() = cell_to_add;
+        tail_string.back() = cell_to_char(cell_to_add);
+        visited.erase(cell_to_remove);
+        visited.insert(cell_to_add);
 
         assert_invariants();
       }
@@ -239,76 +661,877 @@ void solve_index(const SolverDict& solver_dict, const WordsearchGrid& grid,
       break;
     }
 
+    if (donor.wants_work()) {
+      // Shallow layers hold the most unexplored work, give away all but the
+      // sibling we are currently exploring
+      for (const auto i : ranges::views::ints(0UL, q.size())) {
+        if (q[i].size() < 2) {
+          continue;
+        }
+        Tail prefix;
+        for (std::size_t j = 0; j < prefix_size + i; ++j) {
+          prefix.push_back(visited.index(tail[j]));
+        }
+        static_vector<Index, 8> layer;
+        for (auto it = std::next(q[i].begin()); it != q[i].end(); ++it) {
+          layer.push_back(visited.index(it->cell));
+        }
+        q[i].erase(std::next(q[i].begin()), q[i].end());
+        donor.give(SearchTask{std::move(prefix), std::move(layer), true});
+        break;
+      }
+    }
+
     assert_invariants();
 
     assert(!q.back().empty());
     assert(cols > 0);
-    assert(grid.size() > 1); // must be at least bigger than 1 x 1 square
-    const auto n = q.back().front();
-    auto has = [&tail_matrix](const auto y, const auto x) {
-      return tail_matrix(y, x);
-    };
+    assert(!grid.empty());
+    set_suffixes(q.back().front().cell);
+  }
+#undef LOG
+}
 
-    // TODO: move this to function, and then into loop iteration
-    // Avoid using minus operations on x and y as they are unsigned and this
-    // will underflow
-    // Order in which we access adjacent values, eg. SW = SouthWest = {+1, -1}
-    // NW, N, NE, W, E, SW, S, SE
+/** A worker's queue of tasks in a work stealing solve. The owner pushes and
+ * pops at the back, thieves steal from the front where the oldest and so
+ * usually largest tasks are.
+ */
+struct TaskQueue {
+  std::mutex mutex;
+  std::deque<SearchTask> tasks;
+  /** Copy of `tasks.size()` readable without taking the lock */
+  std::atomic<std::size_t> size{0};
 
-    suffixes.clear();
-    suffixes_string.clear();
-    if (n.y > 0 && n.x > 0 && !has(n.y - 1, n.x - 1)) {
-      suffixes.emplace_back(n.y - 1, n.x - 1);
-      suffixes_string.push_back(index_to_char(Index{n.y - 1, n.x - 1}));
-    }
-    if (n.y > 0 && !has(n.y - 1, n.x)) {
-      suffixes.emplace_back(n.y - 1, n.x);
-      suffixes_string.push_back(index_to_char(Index{n.y - 1, n.x}));
-    }
-    if (n.y > 0 && n.x + 1 < cols && !has(n.y - 1, n.x + 1)) {
-      suffixes.emplace_back(n.y - 1, n.x + 1);
-      suffixes_string.push_back(index_to_char(Index{n.y - 1, n.x + 1}));
-    }
-    if (n.x > 0 && !has(n.y, n.x - 1)) {
-      suffixes.emplace_back(n.y, n.x - 1);
-      suffixes_string.push_back(index_to_char(Index{n.y, n.x - 1}));
-    }
-    if (n.x + 1 < cols && !has(n.y, n.x + 1)) {
-      suffixes.emplace_back(n.y, n.x + 1);
-      suffixes_string.push_back(index_to_char(Index{n.y, n.x + 1}));
-    }
-    if (n.y + 1 < rows && n.x > 0 && !has(n.y + 1, n.x - 1)) {
-      suffixes.emplace_back(n.y + 1, n.x - 1);
-      suffixes_string.push_back(index_to_char(Index{n.y + 1, n.x - 1}));
+  void push_back(SearchTask&& task) {
+    std::lock_guard lock{mutex};
+    tasks.push_back(std::move(task));
+    size = tasks.size();
+  }
+
+  std::optional<SearchTask> pop_back() {
+    std::lock_guard lock{mutex};
+    if (tasks.empty()) {
+      return {};
     }
-    if (n.y + 1 < rows && !has(n.y + 1, n.x)) {
-      suffixes.emplace_back(n.y + 1, n.x);
-      suffixes_string.push_back(index_to_char(Index{n.y + 1, n.x}));
+    auto task = std::move(tasks.back());
+    tasks.pop_back();
+    size = tasks.size();
+    return task;
+  }
+
+  std::optional<SearchTask> pop_front() {
+    std::lock_guard lock{mutex};
+    if (tasks.empty()) {
+      return {};
     }
-    if (n.y + 1 < rows && n.x + 1 < cols && !has(n.y + 1, n.x + 1)) {
-      suffixes.emplace_back(n.y + 1, n.x + 1);
-      suffixes_string.push_back(index_to_char(Index{n.y + 1, n.x + 1}));
+    auto task = std::move(tasks.front());
+    tasks.pop_front();
+    size = tasks.size();
+    return task;
+  }
+};
+
+/** Where idle workers in a work stealing solve sleep until there may be
+ * something new to steal, or nothing left to do, rather than spinning.
+ */
+class WorkSignal {
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::size_t numb_signals_ = 0;
+
+public:
+  /** The number of signals so far, to pass to wait() */
+  std::size_t count() {
+    std::lock_guard lock{mutex_};
+    return numb_signals_;
+  }
+
+  /** Wake every waiting worker */
+  void signal() {
+    {
+      std::lock_guard lock{mutex_};
+      ++numb_signals_;
     }
+    condition_.notify_all();
   }
-#undef LOG
+
+  /** Sleep until there has been a signal since count() returned @p seen */
+  void wait(const std::size_t seen) {
+    std::unique_lock lock{mutex_};
+    condition_.wait(lock, [this, seen] { return numb_signals_ != seen; });
+  }
+};
+
+/** Donor for search_task() that gives work to its worker's TaskQueue whenever
+ * another worker is idle and there's nothing left in that queue to steal.
+ */
+struct WorkStealingDonor {
+  TaskQueue& queue;
+  std::atomic<std::size_t>& numb_pending;
+  const std::atomic<std::size_t>& numb_idle;
+  WorkSignal& work_signal;
+
+  bool wants_work() const {
+    return numb_idle.load(std::memory_order_relaxed) > 0 &&
+           queue.size.load(std::memory_order_relaxed) == 0;
+  }
+
+  void give(SearchTask&& task) {
+    ++numb_pending;
+    queue.push_back(std::move(task));
+    work_signal.signal();
+  }
+};
+
+/** Sink that appends each word and path to @p word_to_list_of_indexes */
+inline auto map_sink(WordToListOfListsOfIndexes& word_to_list_of_indexes) {
+  return [&word_to_list_of_indexes](const std::string_view word,
+                                    const Path path) {
+    word_to_list_of_indexes[std::string{word}].emplace_back(path.begin(),
+                                                            path.end());
+  };
+}
+
+/** Whether @p SolverDict is the type erased SolverDictWrapper. Solves given
+ * one visit its variant once up front and search with the dictionary it wraps,
+ * rather than visiting it at every step of the search.
+ */
+template <class SolverDict>
+inline constexpr bool is_wrapper_v =
+    std::is_same_v<SolverDict, SolverDictWrapper>;
+
+/** Adapts a sink taking a word and path for search_task() */
+template <class Sink> auto word_emit(Sink& sink) {
+  return [&sink](const std::string_view word, const Path path, const auto&) {
+    sink(word, path);
+  };
+}
+
+/** Adapts a sink taking a word id and path for search_task() */
+template <class SolverDict, class Sink>
+auto word_id_emit(const SolverDict& solver_dict, Sink& sink) {
+  return [&solver_dict, &sink](const std::string_view, const Path path,
+                               const auto& cursor) {
+    sink(solver_dict.word_id(cursor), path);
+  };
+}
+
+/** solve_index(), but for search_task()'s @p emit rather than a sink, and
+ * @p workspace must already be loaded with @p grid
+ */
+template <class SolverDict, class Emit>
+void search_from(const SolverDict& solver_dict, const WordsearchGrid& grid,
+                 const Index start_index, Emit& emit,
+                 SolverWorkspace<SolverDict>& workspace) {
+  // Unsure if necessary
+  if (grid.empty()) {
+    return;
+  }
+
+  if (start_index.y > grid.rows() || start_index.x > grid.columns()) {
+    throw std::runtime_error("Start index out of range of wordsearch grid");
+  }
+
+  NoDonor donor;
+  search_task(solver_dict, grid, SearchTask{{}, {start_index}, false}, emit,
+              donor, workspace);
+}
+
+} // namespace detail
+
+template <class SolverDict>
+void solve_index(const SolverDict& solver_dict, const WordsearchGrid& grid,
+                 const Index start_index,
+                 WordToListOfListsOfIndexes& word_to_list_of_indexes) {
+  solve_index(solver_dict, grid, start_index,
+              detail::map_sink(word_to_list_of_indexes));
+}
+
+template <class SolverDict, class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                           int>>
+void solve_index(const SolverDict& solver_dict, const WordsearchGrid& grid,
+                 const Index start_index, Sink&& sink) {
+  SolverWorkspace<SolverDict> workspace;
+  solve_index(solver_dict, grid, start_index, sink, workspace);
+}
+
+template <class SolverDict, class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                           int>>
+void solve_index(const SolverDict& solver_dict, const WordsearchGrid& grid,
+                 const Index start_index, Sink&& sink,
+                 SolverWorkspace<SolverDict>& workspace) {
+  auto emit = detail::word_emit(sink);
+  workspace.load(grid);
+  detail::search_from(solver_dict, grid, start_index, emit, workspace);
 }
 
 template <class SolverDict>
 WordToListOfListsOfIndexes solve(const SolverDict& solver_dict,
                                  const WordsearchGrid& grid) {
   WordToListOfListsOfIndexes word_to_list_of_indexes;
+  solve(solver_dict, grid, detail::map_sink(word_to_list_of_indexes));
+  return word_to_list_of_indexes;
+}
 
+template <class SolverDict, class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                           int>>
+void solve(const SolverDict& solver_dict, const WordsearchGrid& grid,
+           Sink&& sink) {
+  if constexpr (detail::is_wrapper_v<SolverDict>) {
+    solver_dict.visit([&](const auto& t) { solve(t, grid, sink); });
+  } else {
+    SolverWorkspace<SolverDict> workspace{grid};
+    solve(solver_dict, grid, sink, workspace);
+  }
+}
+
+template <class SolverDict, class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                           int>>
+void solve(const SolverDict& solver_dict, const WordsearchGrid& grid,
+           Sink&& sink, SolverWorkspace<SolverDict>& workspace) {
+  auto emit = detail::word_emit(sink);
+  workspace.load(grid);
   const auto rows = grid.rows_iter();
   for (const auto& [i, row] : ranges::views::enumerate(rows)) {
     for (const auto [j, elem] : ranges::views::enumerate(row)) {
       // fmt::print("Processing: {}, {}\n", i, j);
-      solve_index(solver_dict, grid, Index{i, j}, word_to_list_of_indexes);
+      detail::search_from(solver_dict, grid, Index{i, j}, emit, workspace);
+    }
+  }
+}
+
+template <class SolverDict>
+WordToListOfListsOfIndexes solve(const SolverDict& solver_dict,
+                                 const WordsearchGrid& grid,
+                                 const LengthLimits limits) {
+  WordToListOfListsOfIndexes word_to_list_of_indexes;
+  solve(solver_dict, grid, limits, detail::map_sink(word_to_list_of_indexes));
+  return word_to_list_of_indexes;
+}
+
+template <class SolverDict, class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                           int>>
+void solve(const SolverDict& solver_dict, const WordsearchGrid& grid,
+           const LengthLimits limits, Sink&& sink) {
+  if constexpr (detail::is_wrapper_v<SolverDict>) {
+    solver_dict.visit([&](const auto& t) { solve(t, grid, limits, sink); });
+  } else {
+    detail::throw_if_invalid(limits);
+    // The maximum is only checked before going a letter deeper, so would still
+    // let single letter words through
+    if (grid.empty() || limits.max_length == 0) {
+      return;
+    }
+
+    auto emit = detail::word_emit(sink);
+    detail::NoDonor donor;
+    SolverWorkspace<SolverDict> workspace{grid};
+    for (std::size_t y = 0; y < grid.rows(); ++y) {
+      for (std::size_t x = 0; x < grid.columns(); ++x) {
+        detail::search_task(solver_dict, grid,
+                            detail::SearchTask{{}, {Index{y, x}}, false}, emit,
+                            donor, workspace, limits);
+      }
     }
   }
+}
+
+template <class SolverDict>
+WordToListOfListsOfIndexes solve(const SolverDict& solver_dict,
+                                 const WordsearchGrid& grid,
+                                 const Adjacency& adjacency) {
+  WordToListOfListsOfIndexes word_to_list_of_indexes;
+  solve(solver_dict, grid, adjacency,
+        detail::map_sink(word_to_list_of_indexes));
   return word_to_list_of_indexes;
 }
 
-template <class Func> auto SolverDictWrapper::run(Func&& func) const {
+template <class SolverDict, class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                           int>>
+void solve(const SolverDict& solver_dict, const WordsearchGrid& grid,
+           const Adjacency& adjacency, Sink&& sink) {
+  if constexpr (detail::is_wrapper_v<SolverDict>) {
+    solver_dict.visit([&](const auto& t) { solve(t, grid, adjacency, sink); });
+  } else {
+    if (adjacency.rows() != grid.rows() ||
+        adjacency.columns() != grid.columns()) {
+      throw std::runtime_error(
+          fmt::format("Adjacency is {} x {} but grid is {} x {}",
+                      adjacency.rows(), adjacency.columns(), grid.rows(),
+                      grid.columns()));
+    }
+    if (grid.empty()) {
+      return;
+    }
+
+    auto emit = detail::word_emit(sink);
+    detail::NoDonor donor;
+    SolverWorkspace<SolverDict> workspace{grid};
+    const auto cols = grid.columns();
+    const auto& masks = adjacency.neighbour_masks();
+
+    // Removed cells stay marked as visited, so no path ever steps onto them
+    std::uint64_t visited_bits = 0;
+    std::vector<unsigned char> visited;
+    if (masks.empty()) {
+      visited.resize(adjacency.size());
+    }
+    for (std::size_t cell = 0; cell < adjacency.size(); ++cell) {
+      if (!adjacency.removed(cell)) {
+        continue;
+      }
+      if (masks.empty()) {
+        visited[cell] = 1;
+      } else {
+        visited_bits |= std::uint64_t{1} << cell;
+      }
+    }
+
+    for (std::size_t cell = 0; cell < adjacency.size(); ++cell) {
+      if (adjacency.removed(cell)) {
+        continue;
+      }
+      detail::SearchTask task{{}, {Index{cell / cols, cell % cols}}, false};
+      if (masks.empty()) {
+        detail::search_task(solver_dict, grid, std::move(task), emit, donor,
+                            workspace,
+                            detail::GraphVisited{visited, adjacency, cols});
+      } else {
+        detail::search_task(
+            solver_dict, grid, std::move(task), emit, donor, workspace,
+            detail::BitboardVisited{visited_bits, masks, cols});
+      }
+    }
+  }
+}
+
+template <class SolverDict, class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::size_t, Path>, int>>
+void solve_word_ids(const SolverDict& solver_dict, const WordsearchGrid& grid,
+                    Sink&& sink) {
+  if constexpr (detail::is_wrapper_v<SolverDict>) {
+    solver_dict.visit([&](const auto& t) { solve_word_ids(t, grid, sink); });
+  } else {
+    auto emit = detail::word_id_emit(solver_dict, sink);
+    SolverWorkspace<SolverDict> workspace{grid};
+    const auto rows = grid.rows_iter();
+    for (const auto& [i, row] : ranges::views::enumerate(rows)) {
+      for (const auto [j, elem] : ranges::views::enumerate(row)) {
+        detail::search_from(solver_dict, grid, Index{i, j}, emit, workspace);
+      }
+    }
+  }
+}
+
+namespace detail {
+
+/** The bitboard of each cell's neighbours in a @p Rows x @p Cols grid, with bit
+ * `y * Cols + x` for cell `(y, x)`
+ */
+template <std::size_t Rows, std::size_t Cols>
+constexpr std::array<std::uint64_t, Rows * Cols> fixed_neighbours() {
+  std::array<std::uint64_t, Rows * Cols> neighbours{};
+  for (std::size_t y = 0; y < Rows; ++y) {
+    for (std::size_t x = 0; x < Cols; ++x) {
+      for (auto ny = y > 0 ? y - 1 : y; ny <= y + 1 && ny < Rows; ++ny) {
+        for (auto nx = x > 0 ? x - 1 : x; nx <= x + 1 && nx < Cols; ++nx) {
+          if (ny != y || nx != x) {
+            neighbours[y * Cols + x] |= std::uint64_t{1} << (ny * Cols + nx);
+          }
+        }
+      }
+    }
+  }
+  return neighbours;
+}
+
+/** search_task() for the whole search from @p start in a grid of fixed size,
+ * see the fixed size solve()
+ *
+ * @param[in] letters The grid's letters, `letters[y * Cols + x]` for `(y, x)`
+ */
+template <std::size_t Rows, std::size_t Cols, class SolverDict, class Sink>
+void search_fixed(const SolverDict& solver_dict,
+                  const std::array<char, Rows * Cols>& letters,
+                  const std::size_t start, Sink& sink) {
+  constexpr auto numb_cells = Rows * Cols;
+  static constexpr auto neighbours = fixed_neighbours<Rows, Cols>();
+  using Cursor = typename SolverDict::Cursor;
+
+  struct Step {
+    std::size_t cell;
+    Cursor cursor;
+  };
+  /** The cells that might lead to more words at one depth of the path, and
+   * which of them is currently being explored
+   */
+  struct Layer {
+    std::array<Step, 8> steps;
+    std::size_t size;
+    std::size_t front;
+  };
+
+  // Everything for the whole search lives here, on the stack. A layer is made
+  // one deeper than the longest path, it is always empty
+  std::array<Layer, numb_cells + 1> layers;
+  std::array<Index, numb_cells> tail;
+  std::array<char, numb_cells> tail_string;
+  std::uint64_t visited = 0;
+
+  // Fill the layer at depth with the cells in candidates that the dictionary
+  // has children for, and output those that finish words, in the same order
+  // search_task() does
+  const auto expand = [&](const std::size_t depth, const Cursor& cursor,
+                          std::uint64_t candidates) {
+    auto& layer = layers[depth];
+    layer.size = 0;
+    layer.front = 0;
+    for (; candidates != 0; candidates &= candidates - 1) {
+      const std::size_t cell = count_trailing_zeros(candidates);
+      const auto child = solver_dict.child(cursor, letters[cell]);
+      if (!child) {
+        continue;
+      }
+      if (solver_dict.is_word(*child)) {
+        tail[depth] = Index{cell / Cols, cell % Cols};
+        tail_string[depth] = letters[cell];
+        sink(std::string_view{tail_string.data(), depth + 1},
+             Path{tail.data(), static_cast<std::ptrdiff_t>(depth + 1)});
+      }
+      if (solver_dict.has_further(*child)) {
+        layer.steps[layer.size++] = Step{cell, *child};
+      }
+    }
+  };
+
+  expand(0, solver_dict.root(), std::uint64_t{1} << start);
+  std::size_t depth = 0;
+  while (true) {
+    auto& layer = layers[depth];
+    if (layer.front == layer.size) {
+      if (depth == 0) {
+        break;
+      }
+      --depth;
+      auto& parent = layers[depth];
+      visited &= ~(std::uint64_t{1} << parent.steps[parent.front].cell);
+      ++parent.front;
+      continue;
+    }
+    const auto& step = layer.steps[layer.front];
+    tail[depth] = Index{step.cell / Cols, step.cell % Cols};
+    tail_string[depth] = letters[step.cell];
+    visited |= std::uint64_t{1} << step.cell;
+    expand(depth + 1, step.cursor, neighbours[step.cell] & ~visited);
+    ++depth;
+  }
+}
+
+} // namespace detail
+
+template <std::size_t Rows, std::size_t Cols, class SolverDict>
+WordToListOfListsOfIndexes solve(const SolverDict& solver_dict,
+                                 const WordsearchGrid& grid) {
+  WordToListOfListsOfIndexes word_to_list_of_indexes;
+  solve<Rows, Cols>(solver_dict, grid,
+                    detail::map_sink(word_to_list_of_indexes));
+  return word_to_list_of_indexes;
+}
+
+template <std::size_t Rows, std::size_t Cols, class SolverDict, class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                           int>>
+void solve(const SolverDict& solver_dict, const WordsearchGrid& grid,
+           Sink&& sink) {
+  static_assert(Rows * Cols > 0, "Grid must have at least one cell");
+  static_assert(Rows * Cols <= 64, "Grid must fit in a 64 bit visited set");
+  if constexpr (detail::is_wrapper_v<SolverDict>) {
+    solver_dict.visit([&](const auto& t) { solve<Rows, Cols>(t, grid, sink); });
+  } else {
+    if (grid.rows() != Rows || grid.columns() != Cols) {
+      throw std::runtime_error(
+          fmt::format("Grid is {} x {}, expected {} x {}", grid.rows(),
+                      grid.columns(), Rows, Cols));
+    }
+
+    std::array<char, Rows * Cols> letters;
+    for (std::size_t y = 0; y < Rows; ++y) {
+      for (std::size_t x = 0; x < Cols; ++x) {
+        letters[y * Cols + x] = grid(y, x);
+      }
+    }
+    for (std::size_t start = 0; start < Rows * Cols; ++start) {
+      detail::search_fixed<Rows, Cols>(solver_dict, letters, start, sink);
+    }
+  }
+}
+
+namespace detail {
+
+/** Appends to @p words every word in @p solver_dict that starts with @p word,
+ * the prefix of @p cursor, whose remaining letters fit in @p counts, and
+ * whose consecutive letters are all in @p adjacent.
+ *
+ * @param[in] letters The distinct letters in the grid, sorted, so that words
+ * are appended in sorted order
+ * @param[in,out] counts How many of each letter are left to use, restored
+ * before returning
+ */
+template <class SolverDict>
+void append_words_in_letters(const SolverDict& solver_dict,
+                             const typename SolverDict::Cursor& cursor,
+                             const std::string_view letters,
+                             std::array<std::size_t, 256>& counts,
+                             const AdjacentLetters& adjacent,
+                             std::string& word,
+                             std::vector<std::string>& words) {
+  for (const auto c : letters) {
+    auto& count = counts[static_cast<unsigned char>(c)];
+    if (count == 0 || (!word.empty() && !adjacent.contains(word.back(), c))) {
+      continue;
+    }
+    const auto child = solver_dict.child(cursor, c);
+    if (!child) {
+      continue;
+    }
+    --count;
+    word.push_back(c);
+    if (solver_dict.is_word(*child)) {
+      words.push_back(word);
+    }
+    if (solver_dict.has_further(*child)) {
+      append_words_in_letters(solver_dict, *child, letters, counts, adjacent,
+                              word, words);
+    }
+    word.pop_back();
+    ++count;
+  }
+}
+
+/** The words of @p solver_dict that could be in @p grid, see prune() */
+template <class SolverDict>
+std::vector<std::string> words_in_grid_letters(const SolverDict& solver_dict,
+                                               const WordsearchGrid& grid) {
+  std::array<std::size_t, 256> counts{};
+  for (const auto& row : grid.rows_iter()) {
+    for (const auto c : row) {
+      ++counts[static_cast<unsigned char>(c)];
+    }
+  }
+  // In unsigned order, the same as std::string compares chars in
+  std::string letters;
+  for (std::size_t c = 0; c < counts.size(); ++c) {
+    if (counts[c] > 0) {
+      letters.push_back(static_cast<char>(c));
+    }
+  }
+
+  const AdjacentLetters adjacent{grid};
+  std::vector<std::string> words;
+  std::string word;
+  append_words_in_letters(solver_dict, solver_dict.root(), letters, counts,
+                          adjacent, word, words);
+  return words;
+}
+
+} // namespace detail
+
+template <class SolverDict>
+SolverDict prune(const SolverDict& solver_dict, const WordsearchGrid& grid) {
+  return SolverDict{detail::words_in_grid_letters(solver_dict, grid)};
+}
+
+namespace detail {
+
+template <class SolverDict>
+WordToListOfListsOfIndexes solve_chunked(const SolverDict& solver_dict,
+                                         const WordsearchGrid& grid,
+                                         const std::size_t numb_threads) {
+  const auto cols = grid.columns();
+  const auto numb_cells = grid.rows() * cols;
+
+  // Several chunks per thread so that a few expensive cells don't leave most
+  // threads idle at the end, but few enough that merging stays cheap
+  const auto chunk_size =
+      std::max(std::size_t{1}, numb_cells / (numb_threads * 8));
+  const auto numb_chunks = (numb_cells + chunk_size - 1) / chunk_size;
+  std::vector<WordToListOfListsOfIndexes> chunk_results(numb_chunks);
+  std::atomic<std::size_t> next_chunk{0};
+
+  const auto worker = [&]() {
+    SolverWorkspace<SolverDict> workspace{grid};
+    for (auto chunk = next_chunk++; chunk < numb_chunks; chunk = next_chunk++) {
+      const auto first = chunk * chunk_size;
+      const auto last = std::min(first + chunk_size, numb_cells);
+      auto sink = map_sink(chunk_results[chunk]);
+      auto emit = word_emit(sink);
+      for (auto cell = first; cell < last; ++cell) {
+        search_from(solver_dict, grid, Index{cell / cols, cell % cols}, emit,
+                    workspace);
+      }
+    }
+  };
+
+  // std::async rather than raw std::thread so that any exception thrown in a
+  // worker is rethrown here by get()
+  std::vector<std::future<void>> workers;
+  workers.reserve(numb_threads - 1);
+  for (std::size_t i = 0; i + 1 < numb_threads; ++i) {
+    workers.push_back(std::async(std::launch::async, worker));
+  }
+  worker();
+  for (auto& w : workers) {
+    w.get();
+  }
+
+  // Chunks are in start cell order, so appending in chunk order reproduces the
+  // order the serial solve() outputs lists of indexes in
+  WordToListOfListsOfIndexes word_to_list_of_indexes =
+      std::move(chunk_results.front());
+  for (auto it = std::next(chunk_results.begin()); it != chunk_results.end();
+       ++it) {
+    for (auto& [word, list_of_indexes] : *it) {
+      auto& dest = word_to_list_of_indexes[word];
+      dest.insert(dest.end(), std::make_move_iterator(list_of_indexes.begin()),
+                  std::make_move_iterator(list_of_indexes.end()));
+    }
+  }
+  return word_to_list_of_indexes;
+}
+
+template <class SolverDict>
+WordToListOfListsOfIndexes
+solve_work_stealing(const SolverDict& solver_dict, const WordsearchGrid& grid,
+                    const std::size_t numb_threads) {
+  const auto cols = grid.columns();
+  const auto numb_cells = grid.rows() * cols;
+
+  // Deal the start cells out in contiguous blocks, one per worker
+  std::vector<TaskQueue> queues(numb_threads);
+  for (std::size_t cell = 0; cell < numb_cells; ++cell) {
+    queues[cell * numb_threads / numb_cells].push_back(
+        SearchTask{{}, {Index{cell / cols, cell % cols}}, false});
+  }
+
+  // Tasks queued or being searched. Only reaches 0 once all are finished, as a
+  // task's donations are counted before that task is
+  std::atomic<std::size_t> numb_pending{numb_cells};
+  std::atomic<std::size_t> numb_idle{0};
+  std::atomic<bool> failed{false};
+  WorkSignal work_signal;
+  std::vector<WordToListOfListsOfIndexes> worker_results(numb_threads);
+
+  const auto worker = [&](const std::size_t id) {
+    WorkStealingDonor donor{queues[id], numb_pending, numb_idle, work_signal};
+    auto sink = map_sink(worker_results[id]);
+    auto emit = word_emit(sink);
+    SolverWorkspace<SolverDict> workspace{grid};
+    bool idle = false;
+    try {
+      while (!failed) {
+        // Read before looking for a task, so a donation made after looking
+        // wakes the wait below
+        const auto seen = work_signal.count();
+        auto task = queues[id].pop_back();
+        for (std::size_t i = 1; !task && i < numb_threads; ++i) {
+          task = queues[(id + i) % numb_threads].pop_front();
+        }
+        if (!task) {
+          if (!idle) {
+            idle = true;
+            ++numb_idle;
+          }
+          if (numb_pending == 0) {
+            break;
+          }
+          work_signal.wait(seen);
+          continue;
+        }
+        if (idle) {
+          idle = false;
+          --numb_idle;
+        }
+        search_task(solver_dict, grid, std::move(*task), emit, donor,
+                    workspace);
+        if (--numb_pending == 0) {
+          work_signal.signal();
+        }
+      }
+    } catch (...) {
+      // Would otherwise leave the other workers waiting forever on our tasks
+      failed = true;
+      work_signal.signal();
+      throw;
+    }
+  };
+
+  std::vector<std::future<void>> workers;
+  workers.reserve(numb_threads - 1);
+  for (std::size_t i = 1; i < numb_threads; ++i) {
+    workers.push_back(std::async(std::launch::async, worker, i));
+  }
+  worker(0);
+  for (auto& w : workers) {
+    w.get();
+  }
+
+  WordToListOfListsOfIndexes word_to_list_of_indexes =
+      std::move(worker_results.front());
+  for (auto it = std::next(worker_results.begin()); it != worker_results.end();
+       ++it) {
+    for (auto& [word, list_of_indexes] : *it) {
+      auto& dest = word_to_list_of_indexes[word];
+      dest.insert(dest.end(), std::make_move_iterator(list_of_indexes.begin()),
+                  std::make_move_iterator(list_of_indexes.end()));
+    }
+  }
+
+  // The serial solve() outputs each word's lists of indexes in depth first
+  // order. Start cells are visited in row major order and neighbours from NW to
+  // SE, so this is the same as ordering the lists lexicographically by (y, x)
+  const auto index_less = [](const Index& a, const Index& b) {
+    return std::tie(a.y, a.x) < std::tie(b.y, b.x);
+  };
+  for (auto& [word, list_of_indexes] : word_to_list_of_indexes) {
+    std::sort(list_of_indexes.begin(), list_of_indexes.end(),
+              [&index_less](const Tail& a, const Tail& b) {
+                return std::lexicographical_compare(a.begin(), a.end(),
+                                                    b.begin(), b.end(),
+                                                    index_less);
+              });
+  }
+  return word_to_list_of_indexes;
+}
+
+} // namespace detail
+
+template <class SolverDict>
+WordToListOfListsOfIndexes solve(const SolverDict& solver_dict,
+                                 const WordsearchGrid& grid,
+                                 std::size_t numb_threads) {
+  return solve(solver_dict, grid, numb_threads, Schedule::chunked);
+}
+
+template <class SolverDict>
+WordToListOfListsOfIndexes solve(const SolverDict& solver_dict,
+                                 const WordsearchGrid& grid,
+                                 std::size_t numb_threads,
+                                 const Schedule schedule) {
+  if constexpr (detail::is_wrapper_v<SolverDict>) {
+    return solver_dict.visit([&](const auto& t) {
+      return solve(t, grid, numb_threads, schedule);
+    });
+  } else {
+    if (numb_threads == 0) {
+      numb_threads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    if (numb_threads == 1 || grid.empty()) {
+      return solve(solver_dict, grid);
+    }
+
+    switch (schedule) {
+    case Schedule::chunked:
+      return detail::solve_chunked(solver_dict, grid, numb_threads);
+    case Schedule::work_stealing:
+      return detail::solve_work_stealing(solver_dict, grid, numb_threads);
+    }
+    throw std::runtime_error("Unknown schedule");
+  }
+}
+
+template <class SolverDict>
+std::vector<BoardStats>
+evaluate_boards(const SolverDict& solver_dict, const std::string_view boards,
+                const std::size_t rows, const std::size_t columns,
+                std::size_t numb_threads) {
+  if constexpr (detail::is_wrapper_v<SolverDict>) {
+    return solver_dict.visit([&](const auto& t) {
+      return evaluate_boards(t, boards, rows, columns, numb_threads);
+    });
+  } else {
+    const auto board_size = rows * columns;
+    if (board_size == 0 || boards.size() % board_size != 0) {
+      throw std::runtime_error(
+          fmt::format("{} chars is not a whole number of {} x {} boards",
+                      boards.size(), rows, columns));
+    }
+    const auto numb_boards = boards.size() / board_size;
+    std::vector<BoardStats> board_stats(numb_boards);
+    if (numb_boards == 0) {
+      return board_stats;
+    }
+    if (numb_threads == 0) {
+      numb_threads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    numb_threads = std::min(numb_threads, numb_boards);
+
+    // Boards are handed out in chunks, as in solve_chunked()
+    const auto chunk_size =
+        std::max(std::size_t{1}, numb_boards / (numb_threads * 8));
+    std::atomic<std::size_t> next_board{0};
+
+    const auto worker = [&]() {
+      WordsearchGrid grid{rows, columns};
+      SolverWorkspace<SolverDict> workspace{grid};
+      // The board each word was last found on plus one, so that it needs no
+      // clearing between boards
+      std::vector<std::size_t> found_on(solver_dict.size(), 0);
+      std::size_t board = 0;
+
+      auto sink = [&](const std::size_t word_id, const Path path) {
+        auto& stats = board_stats[board];
+        ++stats.numb_paths;
+        if (found_on[word_id] != board + 1) {
+          found_on[word_id] = board + 1;
+          ++stats.numb_words;
+          stats.longest_word = std::max(stats.longest_word,
+                                        static_cast<std::size_t>(path.size()));
+        }
+      };
+      auto emit = detail::word_id_emit(solver_dict, sink);
+
+      for (auto first = next_board.fetch_add(chunk_size); first < numb_boards;
+           first = next_board.fetch_add(chunk_size)) {
+        const auto last = std::min(first + chunk_size, numb_boards);
+        for (board = first; board < last; ++board) {
+          const auto letters = boards.substr(board * board_size, board_size);
+          for (std::size_t y = 0; y < rows; ++y) {
+            for (std::size_t x = 0; x < columns; ++x) {
+              grid(y, x) = letters[y * columns + x];
+            }
+          }
+          workspace.load(grid);
+          for (std::size_t y = 0; y < rows; ++y) {
+            for (std::size_t x = 0; x < columns; ++x) {
+              detail::search_from(solver_dict, grid, Index{y, x}, emit,
+                                  workspace);
+            }
+          }
+        }
+      }
+    };
+
+    std::vector<std::future<void>> workers;
+    workers.reserve(numb_threads - 1);
+    for (std::size_t i = 0; i + 1 < numb_threads; ++i) {
+      workers.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& w : workers) {
+      w.get();
+    }
+    return board_stats;
+  }
+}
+
+template <class Func>
+decltype(auto) SolverDictWrapper::visit(Func&& func) const {
   return std::visit(std::forward<Func>(func), t_);
 }
 
@@ -321,7 +1544,7 @@ template <class OutputIndexIterator>
 void SolverDictWrapper::contains_further(
     const std::string_view stem, const std::string_view suffixes,
     OutputIndexIterator contains_further) const {
-  return this->run([=](const auto& t) {
+  return this->visit([=](const auto& t) {
     return t.contains_further(stem, suffixes, contains_further);
   });
 }
@@ -347,6 +1570,31 @@ SolverDictWrapper SolverDictFactory::make(const std::string_view solver,
                              std::forward<Words>(dictionary)};
   }
 #endif
+#ifdef WORDSEARCH_SOLVER_HAS_compact_trie3
+  if (solver == "compact_trie3") {
+    return SolverDictWrapper{std::in_place_type<compact_trie3::CompactTrie3>,
+                             std::forward<Words>(dictionary)};
+  }
+#endif
+#ifdef WORDSEARCH_SOLVER_HAS_double_array_trie
+  if (solver == "double_array_trie") {
+    return SolverDictWrapper{
+        std::in_place_type<double_array_trie::DoubleArrayTrie>,
+        std::forward<Words>(dictionary)};
+  }
+#endif
+#ifdef WORDSEARCH_SOLVER_HAS_dawg
+  if (solver == "dawg") {
+    return SolverDictWrapper{std::in_place_type<dawg::Dawg>,
+                             std::forward<Words>(dictionary)};
+  }
+#endif
+#ifdef WORDSEARCH_SOLVER_HAS_louds_trie
+  if (solver == "louds_trie") {
+    return SolverDictWrapper{std::in_place_type<louds_trie::LoudsTrie>,
+                             std::forward<Words>(dictionary)};
+  }
+#endif
 #ifdef WORDSEARCH_SOLVER_HAS_dictionary_std_vector
   if (solver == "dictionary_std_vector") {
     return SolverDictWrapper{
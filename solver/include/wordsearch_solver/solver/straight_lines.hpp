@@ -0,0 +1,103 @@
+#ifndef STRAIGHT_LINES_HPP
+#define STRAIGHT_LINES_HPP
+
+#include "wordsearch_solver/solver/solver.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace solver {
+
+/** Aho-Corasick automaton over a dictionary's words, for finding every word in
+ * a string in one pass over it.
+ *
+ * Built once from a dictionary, then used by solve_straight_lines() to solve
+ * any number of classic wordsearches, where words only run in straight lines.
+ *
+ * The trie of the words is stored with each state's children in one flat
+ * array, sorted by char as std::string sorts them, so they can be binary
+ * searched. A failure link from each state goes to the state for the longest
+ * proper suffix of its prefix that is also in the trie, and an output link to
+ * the longest one of those that is a word.
+ */
+class AhoCorasick {
+  static constexpr std::uint32_t no_state = UINT32_MAX;
+
+  /** Children of state `s` are at `[child_begin_[s], child_begin_[s + 1])` */
+  std::vector<std::uint32_t> child_begin_;
+  std::vector<char> child_chars_;
+  std::vector<std::uint32_t> child_states_;
+  std::vector<std::uint32_t> fail_;
+  /** Nearest state along the failure links that is a word, or no_state */
+  std::vector<std::uint32_t> output_;
+  /** Length of the word each state is, or 0 if it is not one */
+  std::vector<std::uint32_t> word_size_;
+  std::size_t size_ = 0;
+
+  void init(std::vector<std::string> words);
+  std::uint32_t child(std::uint32_t state, char c) const;
+  std::uint32_t next(std::uint32_t state, char c) const;
+
+public:
+  /** Constructs an automaton matching every word in @p words
+   *
+   * @param[in] words The dictionary's words, in any order and possibly with
+   * duplicates
+   */
+  template <class ForwardRange> explicit AhoCorasick(const ForwardRange& words);
+
+  /** The number of different words */
+  std::size_t size() const;
+
+  /** Checks if there are no words */
+  bool empty() const;
+
+  /** Calls `on_match(end, size)` for every occurrence in @p text of every
+   * word, where the word is `text.substr(end + 1 - size, size)`.
+   *
+   * Occurrences are passed in order of where they end, then longest first.
+   * Takes time linear in the length of @p text plus the number of matches.
+   */
+  template <class OnMatch>
+  void scan(std::string_view text, OnMatch&& on_match) const;
+};
+
+/** Solve a classic wordsearch, where words only run in a straight line in one
+ * of the 8 directions, rather than snaking through any adjacent cells like
+ * solve().
+ *
+ * Every row, column and diagonal of @p grid is scanned with @p automaton
+ * forwards and backwards. This is linear in the size of the grid and the
+ * number of words found. The exponential search solve() does is not needed.
+ *
+ * Single letter words are found once per cell, like with solve().
+ *
+ * @param[in] automaton Built from the dictionary to solve with
+ * @param[in] grid The wordsearch matrix/grid to solve
+ * @returns The map from words to lists of indexes, in the same form as
+ * solve(). Each word's lists of indexes are sorted, as solve() would have
+ * found them.
+ */
+WordToListOfListsOfIndexes solve_straight_lines(const AhoCorasick& automaton,
+                                                const WordsearchGrid& grid);
+
+/** @overload
+ * @param[in] sink Called as `sink(word, path)` with a `std::string_view` and a
+ * Path for every word found, instead of writing them to a map. Words are
+ * passed line by line, so not in the same order as the map's lists.
+ */
+template <class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                           int> = 0>
+void solve_straight_lines(const AhoCorasick& automaton,
+                          const WordsearchGrid& grid, Sink&& sink);
+
+} // namespace solver
+
+#include "wordsearch_solver/solver/straight_lines.tpp"
+
+#endif // STRAIGHT_LINES_HPP
@@ -0,0 +1,101 @@
+#ifndef STRAIGHT_LINES_TPP
+#define STRAIGHT_LINES_TPP
+
+#include "wordsearch_solver/solver/solver.hpp"
+#include "wordsearch_solver/solver/straight_lines.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace solver {
+
+template <class ForwardRange>
+AhoCorasick::AhoCorasick(const ForwardRange& words) {
+  this->init(std::vector<std::string>(std::begin(words), std::end(words)));
+}
+
+template <class OnMatch>
+void AhoCorasick::scan(const std::string_view text, OnMatch&& on_match) const {
+  std::uint32_t state = 0;
+  for (std::size_t i = 0; i < text.size(); ++i) {
+    state = this->next(state, text[i]);
+    for (auto match = word_size_[state] > 0 ? state : output_[state];
+         match != no_state; match = output_[match]) {
+      on_match(i, std::size_t{word_size_[match]});
+    }
+  }
+}
+
+template <class Sink,
+          std::enable_if_t<std::is_invocable_v<Sink&, std::string_view, Path>,
+                           int>>
+void solve_straight_lines(const AhoCorasick& automaton,
+                          const WordsearchGrid& grid, Sink&& sink) {
+  const auto rows = grid.rows();
+  const auto cols = grid.columns();
+  if (grid.empty()) {
+    return;
+  }
+
+  Tail line;
+  std::string line_string;
+  line.reserve(std::max(rows, cols));
+  line_string.reserve(std::max(rows, cols));
+
+  // Scan the line through start in the direction (dy, dx), forwards then
+  // backwards. A step back is a wrapped around unsigned, as adding it wraps
+  // back to the right answer.
+  const auto scan_line = [&](const Index start, const std::size_t dy,
+                             const std::size_t dx, const bool single_letters) {
+    line.clear();
+    line_string.clear();
+    for (auto index = start; index.y < rows && index.x < cols;
+         index = Index{index.y + dy, index.x + dx}) {
+      line.push_back(index);
+      line_string.push_back(grid(index));
+    }
+    for (const auto reversed : {false, true}) {
+      if (reversed) {
+        std::reverse(line.begin(), line.end());
+        std::reverse(line_string.begin(), line_string.end());
+      }
+      automaton.scan(line_string, [&](const std::size_t end,
+                                      const std::size_t size) {
+        // Otherwise found in all 8 directions
+        if (size == 1 && (reversed || !single_letters)) {
+          return;
+        }
+        const auto first = end + 1 - size;
+        sink(std::string_view{line_string}.substr(first, size),
+             Path{line.data() + first, static_cast<std::ptrdiff_t>(size)});
+      });
+    }
+  };
+
+  const auto back = static_cast<std::size_t>(-1);
+  for (std::size_t y = 0; y < rows; ++y) {
+    scan_line(Index{y, 0}, 0, 1, true);
+  }
+  for (std::size_t x = 0; x < cols; ++x) {
+    scan_line(Index{0, x}, 1, 0, false);
+  }
+  // Diagonals running SE start on the top row or the left column, those
+  // running SW on the top row or the right column
+  for (std::size_t x = 0; x < cols; ++x) {
+    scan_line(Index{0, x}, 1, 1, false);
+    scan_line(Index{0, x}, 1, back, false);
+  }
+  for (std::size_t y = 1; y < rows; ++y) {
+    scan_line(Index{y, 0}, 1, 1, false);
+    scan_line(Index{y, cols - 1}, 1, back, false);
+  }
+}
+
+} // namespace solver
+
+#endif // STRAIGHT_LINES_TPP
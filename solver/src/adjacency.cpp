@@ -0,0 +1,164 @@
+#include "wordsearch_solver/solver/adjacency.hpp"
+
+#include "matrix2d/matrix2d.hpp"
+
+#include <range/v3/view/span.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace solver {
+
+Adjacency::Adjacency(const std::size_t rows, const std::size_t columns,
+                     const Topology topology)
+    : rows_(rows), columns_(columns) {
+  std::vector<std::vector<std::size_t>> neighbours(rows * columns);
+
+  // Signed, to step off the top and left edges
+  const auto numb_rows = static_cast<long>(rows);
+  const auto numb_columns = static_cast<long>(columns);
+  for (long y = 0; y < numb_rows; ++y) {
+    for (long x = 0; x < numb_columns; ++x) {
+      auto& cell_neighbours =
+          neighbours[static_cast<std::size_t>(y * numb_columns + x)];
+      const auto add = [&](long ny, long nx) {
+        if (topology == Topology::torus) {
+          ny = (ny + numb_rows) % numb_rows;
+          nx = (nx + numb_columns) % numb_columns;
+        }
+        if (ny >= 0 && ny < numb_rows && nx >= 0 && nx < numb_columns) {
+          cell_neighbours.push_back(
+              static_cast<std::size_t>(ny * numb_columns + nx));
+        }
+      };
+
+      switch (topology) {
+      case Topology::eight:
+      case Topology::torus:
+        for (long dy = -1; dy <= 1; ++dy) {
+          for (long dx = -1; dx <= 1; ++dx) {
+            if (dy != 0 || dx != 0) {
+              add(y + dy, x + dx);
+            }
+          }
+        }
+        break;
+      case Topology::four:
+        add(y - 1, x);
+        add(y, x - 1);
+        add(y, x + 1);
+        add(y + 1, x);
+        break;
+      case Topology::hex: {
+        // Odd rows are shifted right, so their neighbours above and below are
+        // one further right than an even row's
+        const auto shift = y % 2;
+        add(y - 1, x - 1 + shift);
+        add(y - 1, x + shift);
+        add(y, x - 1);
+        add(y, x + 1);
+        add(y + 1, x - 1 + shift);
+        add(y + 1, x + shift);
+        break;
+      }
+      }
+    }
+  }
+  this->init(neighbours);
+}
+
+Adjacency::Adjacency(
+    const std::size_t rows, const std::size_t columns,
+    const std::vector<std::vector<matrix2d::Index>>& neighbours)
+    : rows_(rows), columns_(columns) {
+  if (neighbours.size() != rows * columns) {
+    throw std::out_of_range("Adjacency needs one list of neighbours per cell");
+  }
+  std::vector<std::vector<std::size_t>> cell_neighbours(neighbours.size());
+  for (std::size_t cell = 0; cell < neighbours.size(); ++cell) {
+    for (const auto& index : neighbours[cell]) {
+      if (index.y >= rows || index.x >= columns) {
+        throw std::out_of_range("Neighbour not in the grid");
+      }
+      cell_neighbours[cell].push_back(index.y * columns + index.x);
+    }
+  }
+  this->init(cell_neighbours);
+}
+
+void Adjacency::init(const std::vector<std::vector<std::size_t>>& neighbours) {
+  if (neighbours.size() >= std::numeric_limits<std::uint32_t>::max()) {
+    throw std::length_error("Too many cells for Adjacency");
+  }
+  neighbour_begin_.reserve(neighbours.size() + 1);
+  for (std::size_t cell = 0; cell < neighbours.size(); ++cell) {
+    // Sorted, so the search tries neighbours in the same order as solve() does
+    // without an Adjacency, and without the cell itself or any repeats, which
+    // can come from wrapping around a small torus
+    auto sorted = neighbours[cell];
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    sorted.erase(std::remove(sorted.begin(), sorted.end(), cell),
+                 sorted.end());
+
+    neighbour_begin_.push_back(static_cast<std::uint32_t>(neighbours_.size()));
+    for (const auto neighbour : sorted) {
+      neighbours_.push_back(static_cast<std::uint32_t>(neighbour));
+    }
+  }
+  neighbour_begin_.push_back(static_cast<std::uint32_t>(neighbours_.size()));
+
+  // Same limit as the solver's own bitboards
+  if (neighbours.size() <= 64) {
+    for (std::size_t cell = 0; cell < neighbours.size(); ++cell) {
+      std::uint64_t mask = 0;
+      for (const auto neighbour : this->neighbours(cell)) {
+        mask |= std::uint64_t{1} << neighbour;
+      }
+      neighbour_masks_.push_back(mask);
+    }
+  }
+  removed_.assign(neighbours.size(), 0);
+}
+
+std::size_t Adjacency::rows() const { return rows_; }
+
+std::size_t Adjacency::columns() const { return columns_; }
+
+std::size_t Adjacency::size() const { return removed_.size(); }
+
+void Adjacency::remove(const matrix2d::Index cell) {
+  if (cell.y >= rows_ || cell.x >= columns_) {
+    throw std::out_of_range("Cell not in the grid");
+  }
+  removed_[cell.y * columns_ + cell.x] = 1;
+}
+
+void Adjacency::restore(const matrix2d::Index cell) {
+  if (cell.y >= rows_ || cell.x >= columns_) {
+    throw std::out_of_range("Cell not in the grid");
+  }
+  removed_[cell.y * columns_ + cell.x] = 0;
+}
+
+bool Adjacency::removed(const std::size_t cell) const {
+  return removed_[cell];
+}
+
+ranges::span<const std::uint32_t>
+Adjacency::neighbours(const std::size_t cell) const {
+  const auto first = neighbour_begin_[cell];
+  return {neighbours_.data() + first,
+          static_cast<std::ptrdiff_t>(neighbour_begin_[cell + 1] - first)};
+}
+
+const std::vector<std::uint64_t>& Adjacency::neighbour_masks() const {
+  return neighbour_masks_;
+}
+
+} // namespace solver
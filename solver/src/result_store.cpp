@@ -0,0 +1,219 @@
+#include "wordsearch_solver/solver/result_store.hpp"
+#include "wordsearch_solver/solver/solver.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace solver {
+
+ResultStore::ResultStore(const WordsearchGrid& grid, const ResultMode mode)
+    : columns_(grid.columns()), mode_(mode) {
+  if (grid.size() > std::numeric_limits<std::uint32_t>::max()) {
+    throw std::length_error("Grid too large for ResultStore cell ids");
+  }
+  if (grid.size() > std::numeric_limits<std::uint16_t>::max() + 1UL) {
+    cells_.emplace<std::vector<std::uint32_t>>();
+  }
+}
+
+std::string_view ResultStore::word(const std::uint32_t word_id) const {
+  const auto& entry = words_[word_id];
+  return std::string_view{chars_}.substr(entry.chars_offset, entry.size);
+}
+
+std::uint32_t ResultStore::find_word(const std::string_view word) const {
+  if (word_slots_.empty()) {
+    return no_word;
+  }
+  const auto mask = word_slots_.size() - 1;
+  for (auto slot = std::hash<std::string_view>{}(word) & mask;;
+       slot = (slot + 1) & mask) {
+    const auto id_plus_one = word_slots_[slot];
+    if (id_plus_one == 0) {
+      return no_word;
+    }
+    if (this->word(id_plus_one - 1) == word) {
+      return id_plus_one - 1;
+    }
+  }
+}
+
+std::uint32_t ResultStore::insert_word(const std::string_view word) {
+  // Keep the table at most half full, and a power of 2 in size for masking
+  if ((words_.size() + 1) * 2 > word_slots_.size()) {
+    std::vector<std::uint32_t> slots(
+        std::max(std::size_t{16}, word_slots_.size() * 2), 0);
+    const auto mask = slots.size() - 1;
+    for (std::uint32_t id = 0; id < words_.size(); ++id) {
+      auto slot = std::hash<std::string_view>{}(this->word(id)) & mask;
+      while (slots[slot] != 0) {
+        slot = (slot + 1) & mask;
+      }
+      slots[slot] = id + 1;
+    }
+    word_slots_ = std::move(slots);
+  }
+
+  if (chars_.size() + word.size() > std::numeric_limits<std::uint32_t>::max() ||
+      words_.size() + 1 >= no_word) {
+    throw std::length_error("Too many words for ResultStore");
+  }
+  const auto word_id = static_cast<std::uint32_t>(words_.size());
+  words_.push_back(WordEntry{static_cast<std::uint32_t>(chars_.size()),
+                             static_cast<std::uint32_t>(word.size()), 0, 0});
+  chars_.append(word);
+
+  const auto mask = word_slots_.size() - 1;
+  auto slot = std::hash<std::string_view>{}(word) & mask;
+  while (word_slots_[slot] != 0) {
+    slot = (slot + 1) & mask;
+  }
+  word_slots_[slot] = word_id + 1;
+  return word_id;
+}
+
+Index ResultStore::cell(const std::size_t offset) const {
+  const std::size_t id = std::visit(
+      [offset](const auto& cells) -> std::size_t { return cells[offset]; },
+      cells_);
+  return Index{id / columns_, id % columns_};
+}
+
+void ResultStore::check_finished() const {
+  if (!pending_.empty()) {
+    throw std::logic_error("ResultStore read before finish()");
+  }
+}
+
+void ResultStore::add(const std::string_view word, const Path path) {
+  assert(static_cast<std::size_t>(path.size()) == word.size());
+  if (columns_ == 0) {
+    throw std::logic_error("Default constructed ResultStore has no grid");
+  }
+
+  ++numb_found_;
+  if (mode_ == ResultMode::count_only) {
+    return;
+  }
+
+  auto word_id = this->find_word(word);
+  if (word_id == no_word) {
+    word_id = this->insert_word(word);
+  } else if (mode_ == ResultMode::first_path_per_word) {
+    return;
+  }
+  if (mode_ == ResultMode::words_only) {
+    return;
+  }
+
+  const auto cells_offset =
+      std::visit([](const auto& cells) { return cells.size(); }, cells_);
+  if (cells_offset + word.size() > std::numeric_limits<std::uint32_t>::max() ||
+      paths_.size() + pending_.size() >=
+          std::numeric_limits<std::uint32_t>::max()) {
+    throw std::length_error("Too many paths for ResultStore");
+  }
+  std::visit(
+      [this, path](auto& cells) {
+        using Id = typename std::decay_t<decltype(cells)>::value_type;
+        for (const auto& index : path) {
+          cells.push_back(static_cast<Id>(index.y * columns_ + index.x));
+        }
+      },
+      cells_);
+
+  pending_.push_back(
+      PendingPath{word_id, PathEntry{static_cast<std::uint32_t>(cells_offset),
+                                     static_cast<std::uint32_t>(word.size())}});
+}
+
+void ResultStore::finish() {
+  if (pending_.empty()) {
+    return;
+  }
+
+  // Counting sort by word id. Each word's already grouped paths go first, then
+  // its pending ones in the order they were added.
+  std::vector<std::uint32_t> numb_pending(words_.size(), 0);
+  for (const auto& pending : pending_) {
+    ++numb_pending[pending.word_id];
+  }
+  std::vector<PathEntry> paths(paths_.size() + pending_.size());
+  std::uint32_t first_path = 0;
+  for (std::size_t word_id = 0; word_id < words_.size(); ++word_id) {
+    auto& entry = words_[word_id];
+    const auto numb_grouped = entry.last_path - entry.first_path;
+    std::copy(paths_.begin() + entry.first_path,
+              paths_.begin() + entry.last_path, paths.begin() + first_path);
+    entry.first_path = first_path;
+    entry.last_path = first_path + numb_grouped;
+    first_path = entry.last_path + numb_pending[word_id];
+  }
+  for (const auto& pending : pending_) {
+    paths[words_[pending.word_id].last_path++] = pending.path;
+  }
+
+  paths_ = std::move(paths);
+  pending_.clear();
+}
+
+void ResultStore::count_found() { ++numb_found_; }
+
+std::size_t ResultStore::size() const { return words_.size(); }
+
+bool ResultStore::empty() const { return words_.empty(); }
+
+std::size_t ResultStore::numb_paths() const {
+  return paths_.size() + pending_.size();
+}
+
+std::size_t ResultStore::numb_found() const { return numb_found_; }
+
+ResultMode ResultStore::mode() const { return mode_; }
+
+bool ResultStore::contains(const std::string_view word) const {
+  return this->find_word(word) != no_word;
+}
+
+ResultStore::Paths ResultStore::at(const std::string_view word) const {
+  this->check_finished();
+  const auto word_id = this->find_word(word);
+  if (word_id == no_word) {
+    throw std::out_of_range("No such word in ResultStore");
+  }
+  return Paths{this, word_id};
+}
+
+ResultStore::const_iterator ResultStore::begin() const {
+  this->check_finished();
+  return {this, 0};
+}
+
+ResultStore::const_iterator ResultStore::end() const {
+  return {this, static_cast<std::uint32_t>(words_.size())};
+}
+
+WordToListOfListsOfIndexes ResultStore::to_map() const {
+  WordToListOfListsOfIndexes word_to_list_of_indexes;
+  for (const auto& [word, paths] : *this) {
+    auto& list_of_indexes = word_to_list_of_indexes[std::string{word}];
+    list_of_indexes.reserve(paths.size());
+    for (const auto& path : paths) {
+      list_of_indexes.push_back(path.to_tail());
+    }
+  }
+  return word_to_list_of_indexes;
+}
+
+} // namespace solver
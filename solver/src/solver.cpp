@@ -2,14 +2,20 @@
 #include "matrix2d/matrix2d.hpp"
 #include "wordsearch_solver/config.hpp"
 
+#include <fmt/core.h>
 #include <range/v3/numeric/accumulate.hpp>
 #include <range/v3/range/primitives.hpp>
 #include <range/v3/view/all.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace solver {
@@ -33,20 +39,133 @@ WordsearchGrid make_grid(const std::vector<std::string>& lines) {
   return grid;
 }
 
+void detail::sort_as_solved(
+    WordToListOfListsOfIndexes& word_to_list_of_indexes) {
+  const auto index_less = [](const Index& a, const Index& b) {
+    return std::tie(a.y, a.x) < std::tie(b.y, b.x);
+  };
+  for (auto& [word, list_of_indexes] : word_to_list_of_indexes) {
+    std::sort(list_of_indexes.begin(), list_of_indexes.end(),
+              [&index_less](const Tail& a, const Tail& b) {
+                return std::lexicographical_compare(a.begin(), a.end(),
+                                                    b.begin(), b.end(),
+                                                    index_less);
+              });
+  }
+}
+
+void detail::throw_if_invalid(const LengthLimits limits) {
+  if (limits.min_length > limits.max_length) {
+    throw std::runtime_error(
+        fmt::format("Minimum word length {} is more than the maximum {}",
+                    limits.min_length, limits.max_length));
+  }
+}
+
 std::size_t SolverDictWrapper::size() const {
-  return this->run([](const auto& t) { return t.size(); });
+  return this->visit([](const auto& t) { return t.size(); });
 }
 
 bool SolverDictWrapper::empty() const {
-  return this->run([](const auto& t) { return t.empty(); });
+  return this->visit([](const auto& t) { return t.empty(); });
+}
+
+std::size_t SolverDictWrapper::max_word_length() const {
+  return this->visit([](const auto& t) { return t.max_word_length(); });
 }
 
 bool SolverDictWrapper::contains(const std::string_view key) const {
-  return this->run([key](const auto& t) { return t.contains(key); });
+  return this->visit([key](const auto& t) { return t.contains(key); });
 }
 
 bool SolverDictWrapper::further(const std::string_view key) const {
-  return this->run([key](const auto& t) { return t.further(key); });
+  return this->visit([key](const auto& t) { return t.further(key); });
+}
+
+SolverDictWrapper::Cursor SolverDictWrapper::root() const {
+  return this->visit([](const auto& t) -> Cursor {
+    using TCursor = typename std::decay_t<decltype(t)>::Cursor;
+    return Cursor{std::in_place_type<TCursor>, t.root()};
+  });
+}
+
+std::optional<SolverDictWrapper::Cursor>
+SolverDictWrapper::child(const Cursor& cursor, const char c) const {
+  return this->visit([&cursor, c](const auto& t) -> std::optional<Cursor> {
+    using TCursor = typename std::decay_t<decltype(t)>::Cursor;
+    if (const auto child = t.child(std::get<TCursor>(cursor), c)) {
+      return Cursor{std::in_place_type<TCursor>, *child};
+    }
+    return {};
+  });
+}
+
+bool SolverDictWrapper::is_word(const Cursor& cursor) const {
+  return this->visit([&cursor](const auto& t) {
+    using TCursor = typename std::decay_t<decltype(t)>::Cursor;
+    return t.is_word(std::get<TCursor>(cursor));
+  });
+}
+
+bool SolverDictWrapper::has_further(const Cursor& cursor) const {
+  return this->visit([&cursor](const auto& t) {
+    using TCursor = typename std::decay_t<decltype(t)>::Cursor;
+    return t.has_further(std::get<TCursor>(cursor));
+  });
+}
+
+std::size_t SolverDictWrapper::word_id(const Cursor& cursor) const {
+  return this->visit([&cursor](const auto& t) {
+    using TCursor = typename std::decay_t<decltype(t)>::Cursor;
+    return t.word_id(std::get<TCursor>(cursor));
+  });
+}
+
+std::string SolverDictWrapper::word(const std::size_t id) const {
+  return this->visit([id](const auto& t) { return t.word(id); });
+}
+
+AdjacentLetters::AdjacentLetters(const WordsearchGrid& grid) : pairs_(256) {
+  const auto rows = grid.rows();
+  const auto cols = grid.columns();
+  const auto add = [this, &grid](const Index a, const Index b) {
+    const auto a_char = static_cast<unsigned char>(grid(a));
+    const auto b_char = static_cast<unsigned char>(grid(b));
+    pairs_[a_char].set(b_char);
+    pairs_[b_char].set(a_char);
+  };
+  // Each cell's neighbours to the E, SW, S and SE, which covers every pair of
+  // neighbours once, in both orders
+  for (std::size_t y = 0; y < rows; ++y) {
+    for (std::size_t x = 0; x < cols; ++x) {
+      if (x + 1 < cols) {
+        add(Index{y, x}, Index{y, x + 1});
+      }
+      if (y + 1 < rows && x > 0) {
+        add(Index{y, x}, Index{y + 1, x - 1});
+      }
+      if (y + 1 < rows) {
+        add(Index{y, x}, Index{y + 1, x});
+      }
+      if (y + 1 < rows && x + 1 < cols) {
+        add(Index{y, x}, Index{y + 1, x + 1});
+      }
+    }
+  }
+}
+
+bool AdjacentLetters::contains(const char a, const char b) const {
+  return pairs_[static_cast<unsigned char>(a)].test(
+      static_cast<unsigned char>(b));
+}
+
+SolverDictWrapper prune(const SolverDictWrapper& solver_dict,
+                        const WordsearchGrid& grid) {
+  return solver_dict.visit([&grid](const auto& t) {
+    using T = std::decay_t<decltype(t)>;
+    return SolverDictWrapper{std::in_place_type<T>,
+                             detail::words_in_grid_letters(t, grid)};
+  });
 }
 
 SolverDictFactory::SolverDictFactory() {
@@ -59,6 +178,18 @@ SolverDictFactory::SolverDictFactory() {
 #ifdef WORDSEARCH_SOLVER_HAS_compact_trie2
   solvers.push_back("compact_trie2");
 #endif
+#ifdef WORDSEARCH_SOLVER_HAS_compact_trie3
+  solvers.push_back("compact_trie3");
+#endif
+#ifdef WORDSEARCH_SOLVER_HAS_double_array_trie
+  solvers.push_back("double_array_trie");
+#endif
+#ifdef WORDSEARCH_SOLVER_HAS_dawg
+  solvers.push_back("dawg");
+#endif
+#ifdef WORDSEARCH_SOLVER_HAS_louds_trie
+  solvers.push_back("louds_trie");
+#endif
 #ifdef WORDSEARCH_SOLVER_HAS_dictionary_std_vector
   solvers.push_back("dictionary_std_vector");
 #endif
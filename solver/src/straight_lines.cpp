@@ -0,0 +1,133 @@
+#include "wordsearch_solver/solver/straight_lines.hpp"
+#include "wordsearch_solver/solver/solver.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace solver {
+
+void AhoCorasick::init(std::vector<std::string> words) {
+  std::sort(words.begin(), words.end());
+  words.erase(std::unique(words.begin(), words.end()), words.end());
+  words.erase(std::remove(words.begin(), words.end(), std::string{}),
+              words.end());
+  size_ = words.size();
+
+  // Build the trie. As the words are sorted, each node's children are created
+  // in sorted order, and the child a word continues with is always the last
+  std::vector<std::vector<std::pair<char, std::uint32_t>>> children(1);
+  std::vector<std::uint32_t> word_size(1, 0);
+  for (const auto& word : words) {
+    std::uint32_t state = 0;
+    for (const auto c : word) {
+      auto& state_children = children[state];
+      if (state_children.empty() || state_children.back().first != c) {
+        if (children.size() >= no_state) {
+          throw std::length_error("Too many states for AhoCorasick");
+        }
+        state_children.emplace_back(
+            c, static_cast<std::uint32_t>(children.size()));
+        children.emplace_back();
+        word_size.push_back(0);
+      }
+      state = children[state].back().second;
+    }
+    if (word.size() > std::numeric_limits<std::uint32_t>::max()) {
+      throw std::length_error("Word too long for AhoCorasick");
+    }
+    word_size[state] = static_cast<std::uint32_t>(word.size());
+  }
+
+  const auto numb_states = children.size();
+  child_begin_.clear();
+  child_chars_.clear();
+  child_states_.clear();
+  child_begin_.reserve(numb_states + 1);
+  child_chars_.reserve(numb_states - 1);
+  child_states_.reserve(numb_states - 1);
+  for (const auto& state_children : children) {
+    child_begin_.push_back(static_cast<std::uint32_t>(child_chars_.size()));
+    for (const auto& [c, child] : state_children) {
+      child_chars_.push_back(c);
+      child_states_.push_back(child);
+    }
+  }
+  child_begin_.push_back(static_cast<std::uint32_t>(child_chars_.size()));
+  word_size_ = std::move(word_size);
+
+  // Breadth first, so that a state's failure link is always to a shallower
+  // state whose own links are already set
+  fail_.assign(numb_states, 0);
+  output_.assign(numb_states, no_state);
+  std::deque<std::uint32_t> q{0};
+  while (!q.empty()) {
+    const auto state = q.front();
+    q.pop_front();
+    for (auto i = child_begin_[state]; i < child_begin_[state + 1]; ++i) {
+      const auto c = child_chars_[i];
+      const auto child = child_states_[i];
+      q.push_back(child);
+      if (state == 0) {
+        continue;
+      }
+      const auto fail = this->next(fail_[state], c);
+      fail_[child] = fail;
+      output_[child] = word_size_[fail] > 0 ? fail : output_[fail];
+    }
+  }
+}
+
+std::uint32_t AhoCorasick::child(const std::uint32_t state,
+                                 const char c) const {
+  const auto first =
+      std::next(child_chars_.begin(), static_cast<long>(child_begin_[state]));
+  const auto last = std::next(child_chars_.begin(),
+                              static_cast<long>(child_begin_[state + 1]));
+  // Children are in the order the sorted words gave them, which compares chars
+  // as unsigned
+  const auto it = std::lower_bound(first, last, c, [](const char a,
+                                                      const char b) {
+    return static_cast<unsigned char>(a) < static_cast<unsigned char>(b);
+  });
+  if (it == last || *it != c) {
+    return no_state;
+  }
+  return child_states_[static_cast<std::size_t>(
+      std::distance(child_chars_.begin(), it))];
+}
+
+std::uint32_t AhoCorasick::next(std::uint32_t state, const char c) const {
+  while (true) {
+    const auto child = this->child(state, c);
+    if (child != no_state) {
+      return child;
+    }
+    if (state == 0) {
+      return 0;
+    }
+    state = fail_[state];
+  }
+}
+
+std::size_t AhoCorasick::size() const { return size_; }
+
+bool AhoCorasick::empty() const { return size_ == 0; }
+
+WordToListOfListsOfIndexes solve_straight_lines(const AhoCorasick& automaton,
+                                                const WordsearchGrid& grid) {
+  WordToListOfListsOfIndexes word_to_list_of_indexes;
+  solve_straight_lines(automaton, grid,
+                       detail::map_sink(word_to_list_of_indexes));
+
+  detail::sort_as_solved(word_to_list_of_indexes);
+  return word_to_list_of_indexes;
+}
+
+} // namespace solver
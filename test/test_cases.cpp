@@ -20,10 +20,13 @@
 #include <functional>
 #include <iostream>
 #include <map>
+#include <random>
 #include <set>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -199,3 +202,853 @@ TEST_CASE("Test all dictionary implementation's output equal each other",
     check_output_equal<WORDSEARCH_DICTIONARY_CLASSES>(grid, lines);
   }
 }
+
+template <class SolverDict>
+void check_parallel_solve_equals_serial(
+    const std::vector<std::string>& dict_words) {
+  const SolverDict dict{dict_words};
+  for (const auto& test_dir : fs::directory_iterator(test_cases_dirname)) {
+    if (!fs::is_directory(test_dir)) {
+      continue;
+    }
+    const auto grid = solver::make_grid(
+        utility::read_file_as_lines(test_dir / wordsearch_filename));
+    const auto serial = solver::solve(dict, grid);
+    for (const std::size_t numb_threads : {0UL, 1UL, 2UL, 3UL, 16UL}) {
+      INFO(fmt::format("{} threads on {}", numb_threads,
+                       test_dir.path().string()));
+      CHECK(solver::solve(dict, grid, numb_threads) == serial);
+      CHECK(solver::solve(dict, grid, numb_threads,
+                          solver::Schedule::work_stealing) == serial);
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE("Parallel solve output equals serial solve",
+                   "[solve][parallel]", WORDSEARCH_DICTIONARY_CLASSES) {
+  check_inputs();
+
+  const auto dict_words = sort_unique(
+      utility::read_file_as_lines(test_cases_dirname / dictionary_filename));
+  check_parallel_solve_equals_serial<TestType>(dict_words);
+}
+
+// Every path of every word in @p words through @p grid, found by walking each
+// word letter by letter from each cell. Only checks letters against one word
+// at a time so that it shares nothing with the solver's search, as the
+// reference for what the sink should be handed.
+solver::WordToListOfListsOfIndexes
+brute_force_solve(const std::vector<std::string>& words,
+                  const solver::WordsearchGrid& grid) {
+  solver::WordToListOfListsOfIndexes found;
+  solver::Tail path;
+  const std::function<void(const std::string&)> extend =
+      [&](const std::string& word) {
+        if (path.size() == word.size()) {
+          found[word].push_back(path);
+          return;
+        }
+        const auto last = path.back();
+        for (std::size_t y = last.y > 0 ? last.y - 1 : 0;
+             y <= last.y + 1 && y < grid.rows(); ++y) {
+          for (std::size_t x = last.x > 0 ? last.x - 1 : 0;
+               x <= last.x + 1 && x < grid.columns(); ++x) {
+            const solver::Index next{y, x};
+            if (grid(next) != word[path.size()] ||
+                std::find(path.begin(), path.end(), next) != path.end()) {
+              continue;
+            }
+            path.push_back(next);
+            extend(word);
+            path.pop_back();
+          }
+        }
+      };
+  for (const auto& word : words) {
+    for (std::size_t y = 0; y < grid.rows(); ++y) {
+      for (std::size_t x = 0; x < grid.columns(); ++x) {
+        if (!word.empty() && grid(solver::Index{y, x}) == word.front()) {
+          path.assign({solver::Index{y, x}});
+          extend(word);
+        }
+      }
+    }
+  }
+  return found;
+}
+
+// Sorts each word's paths so that results found in different orders compare
+// equal
+solver::WordToListOfListsOfIndexes
+sort_paths(solver::WordToListOfListsOfIndexes results) {
+  const auto less = [](const solver::Tail& a, const solver::Tail& b) {
+    return std::lexicographical_compare(
+        a.begin(), a.end(), b.begin(), b.end(),
+        [](const solver::Index i, const solver::Index j) {
+          return std::tie(i.y, i.x) < std::tie(j.y, j.x);
+        });
+  };
+  for (auto& [word, list_of_indexes] : results) {
+    std::sort(list_of_indexes.begin(), list_of_indexes.end(), less);
+  }
+  return results;
+}
+
+TEMPLATE_TEST_CASE("Sink solve passes the words and paths a brute force "
+                   "search finds",
+                   "[solve][sink]", WORDSEARCH_DICTIONARY_CLASSES) {
+  check_inputs();
+
+  const auto dict_words = sort_unique(
+      utility::read_file_as_lines(test_cases_dirname / dictionary_filename));
+  const TestType dict{dict_words};
+
+  const auto check_sink = [&dict, &dict_words](
+                              const solver::WordsearchGrid& grid) {
+    solver::WordToListOfListsOfIndexes from_sink;
+    solver::solve(dict, grid,
+                  [&from_sink](const std::string_view word,
+                               const solver::Path path) {
+                    REQUIRE(static_cast<std::size_t>(path.size()) ==
+                            word.size());
+                    from_sink[std::string{word}].emplace_back(path.begin(),
+                                                              path.end());
+                  });
+    CHECK(sort_paths(from_sink) == sort_paths(brute_force_solve(dict_words,
+                                                                grid)));
+    return from_sink;
+  };
+
+  for (const auto& test_dir : fs::directory_iterator(test_cases_dirname)) {
+    if (!fs::is_directory(test_dir)) {
+      continue;
+    }
+    INFO(test_dir.path().string());
+    const auto from_sink = check_sink(solver::make_grid(
+        utility::read_file_as_lines(test_dir / wordsearch_filename)));
+    for (const auto& answer :
+         utility::read_file_as_lines(test_dir / answers_filename)) {
+      CHECK(from_sink.count(answer) == 1);
+    }
+  }
+
+  // Repeated letters give a word many paths, and paths that revisit a cell
+  // which must not be passed on
+  for (const auto& lines : {std::vector<std::string>{"sese", "eses", "sese"},
+                            std::vector<std::string>{"tatt", "ooat", "ttoo"},
+                            std::vector<std::string>{"aaa", "aaa"}}) {
+    INFO(lines.front());
+    const auto from_sink = check_sink(solver::make_grid(lines));
+    CHECK(!from_sink.empty());
+  }
+  const auto sees = check_sink(solver::make_grid({"se", "es"}));
+  REQUIRE(sees.count("sees") == 1);
+  // Starting from either s, each of the two e's can come first
+  CHECK(sees.at("sees").size() == 4);
+}
+
+TEMPLATE_TEST_CASE("ResultStore holds the same words and paths as solve",
+                   "[solve][result_store]", WORDSEARCH_DICTIONARY_CLASSES) {
+  check_inputs();
+
+  const TestType dict{sort_unique(
+      utility::read_file_as_lines(test_cases_dirname / dictionary_filename))};
+  for (const auto& test_dir : fs::directory_iterator(test_cases_dirname)) {
+    if (!fs::is_directory(test_dir)) {
+      continue;
+    }
+    INFO(test_dir.path().string());
+    const auto grid = solver::make_grid(
+        utility::read_file_as_lines(test_dir / wordsearch_filename));
+    const auto expected = solver::solve(dict, grid);
+
+    solver::ResultStore results{grid};
+    solver::solve(dict, grid, results);
+    if (!expected.empty()) {
+      CHECK_THROWS_AS(results.begin(), std::logic_error);
+    }
+    results.finish();
+    CHECK(results.to_map() == expected);
+    CHECK(results.size() == expected.size());
+
+    std::size_t numb_paths = 0;
+    for (const auto& [word, paths] : results) {
+      REQUIRE(results.contains(word));
+      const auto& expected_paths = expected.at(std::string{word});
+      REQUIRE(results.at(word).size() == expected_paths.size());
+      auto expected_it = expected_paths.begin();
+      for (const auto& path : paths) {
+        CHECK(std::equal(path.begin(), path.end(), expected_it->begin(),
+                         expected_it->end()));
+        ++expected_it;
+        ++numb_paths;
+      }
+    }
+    CHECK(numb_paths == results.numb_paths());
+    CHECK(!results.contains("notawordinthisgrid"));
+    CHECK_THROWS_AS(results.at("notawordinthisgrid"), std::out_of_range);
+
+    // Solving again into the same store puts each word's new paths after its
+    // old ones
+    solver::solve(dict, grid, results);
+    results.finish();
+    CHECK(results.size() == expected.size());
+    CHECK(results.numb_paths() == 2 * numb_paths);
+    for (const auto& [word, paths] : results) {
+      const auto& once = expected.at(std::string{word});
+      auto twice = once;
+      twice.insert(twice.end(), once.begin(), once.end());
+      std::vector<solver::Tail> tails;
+      for (const auto& path : paths) {
+        tails.push_back(path.to_tail());
+      }
+      CHECK(tails == twice);
+    }
+
+    if (!expected.empty()) {
+      const auto& [word, list_of_indexes] = *expected.begin();
+      solver::ResultStore no_grid;
+      CHECK_THROWS_AS(no_grid.add(word, list_of_indexes.front()),
+                      std::logic_error);
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE("Cheaper result modes agree with all paths",
+                   "[solve][result_store]", WORDSEARCH_DICTIONARY_CLASSES) {
+  check_inputs();
+
+  const TestType dict{sort_unique(
+      utility::read_file_as_lines(test_cases_dirname / dictionary_filename))};
+  for (const auto& test_dir : fs::directory_iterator(test_cases_dirname)) {
+    if (!fs::is_directory(test_dir)) {
+      continue;
+    }
+    INFO(test_dir.path().string());
+    const auto grid = solver::make_grid(
+        utility::read_file_as_lines(test_dir / wordsearch_filename));
+    const auto expected = solver::solve(dict, grid);
+    std::size_t expected_numb_paths = 0;
+    for (const auto& [word, list_of_indexes] : expected) {
+      expected_numb_paths += list_of_indexes.size();
+    }
+
+    const auto all_paths =
+        solver::solve(dict, grid, solver::ResultMode::all_paths);
+    CHECK(all_paths.to_map() == expected);
+    CHECK(all_paths.numb_found() == expected_numb_paths);
+
+    const auto first_path =
+        solver::solve(dict, grid, solver::ResultMode::first_path_per_word);
+    CHECK(first_path.size() == expected.size());
+    CHECK(first_path.numb_paths() == expected.size());
+    CHECK(first_path.numb_found() == expected_numb_paths);
+    for (const auto& [word, paths] : first_path) {
+      REQUIRE(paths.size() == 1);
+      CHECK((*paths.begin()).to_tail() ==
+            expected.at(std::string{word}).front());
+    }
+
+    const auto words_only =
+        solver::solve(dict, grid, solver::ResultMode::words_only);
+    CHECK(words_only.size() == expected.size());
+    CHECK(words_only.numb_paths() == 0);
+    CHECK(words_only.numb_found() == expected_numb_paths);
+    for (const auto& [word, paths] : words_only) {
+      CHECK(expected.count(std::string{word}) == 1);
+      CHECK(paths.size() == 0);
+    }
+
+    const auto count_only =
+        solver::solve(dict, grid, solver::ResultMode::count_only);
+    CHECK(count_only.empty());
+    CHECK(count_only.numb_found() == expected_numb_paths);
+  }
+}
+
+TEMPLATE_TEST_CASE("Word id solve finds the same words and paths as solve",
+                   "[solve][word_id]", WORDSEARCH_DICTIONARY_CLASSES) {
+  check_inputs();
+
+  const TestType dict{sort_unique(
+      utility::read_file_as_lines(test_cases_dirname / dictionary_filename))};
+  for (const auto& test_dir : fs::directory_iterator(test_cases_dirname)) {
+    if (!fs::is_directory(test_dir)) {
+      continue;
+    }
+    INFO(test_dir.path().string());
+    const auto grid = solver::make_grid(
+        utility::read_file_as_lines(test_dir / wordsearch_filename));
+
+    std::vector<solver::ListOfListsOfIndexes> id_to_list_of_indexes(
+        dict.size());
+    solver::solve_word_ids(
+        dict, grid, [&id_to_list_of_indexes](const std::size_t id,
+                                             const solver::Path path) {
+          REQUIRE(id < id_to_list_of_indexes.size());
+          id_to_list_of_indexes[id].emplace_back(path.begin(), path.end());
+        });
+
+    solver::WordToListOfListsOfIndexes from_ids;
+    for (std::size_t id = 0; id < id_to_list_of_indexes.size(); ++id) {
+      if (!id_to_list_of_indexes[id].empty()) {
+        from_ids.emplace(dict.word(id), std::move(id_to_list_of_indexes[id]));
+      }
+    }
+    CHECK(from_ids == solver::solve(dict, grid));
+  }
+}
+
+TEMPLATE_TEST_CASE("A workspace reused across grids gives the same results",
+                   "[solve][workspace]", WORDSEARCH_DICTIONARY_CLASSES) {
+  check_inputs();
+
+  const TestType dict{sort_unique(
+      utility::read_file_as_lines(test_cases_dirname / dictionary_filename))};
+  // One workspace for every grid, which differ in shape, and a search given up
+  // part way through by a throwing sink in between each
+  solver::SolverWorkspace<TestType> workspace;
+  for (const auto& test_dir : fs::directory_iterator(test_cases_dirname)) {
+    if (!fs::is_directory(test_dir)) {
+      continue;
+    }
+    INFO(test_dir.path().string());
+    const auto grid = solver::make_grid(
+        utility::read_file_as_lines(test_dir / wordsearch_filename));
+
+    solver::WordToListOfListsOfIndexes from_workspace;
+    solver::solve(
+        dict, grid,
+        [&from_workspace](const std::string_view word,
+                          const solver::Path path) {
+          from_workspace[std::string{word}].emplace_back(path.begin(),
+                                                         path.end());
+        },
+        workspace);
+    CHECK(from_workspace == solver::solve(dict, grid));
+
+    std::size_t numb_found = 0;
+    const auto abandon = [&numb_found](const std::string_view,
+                                       const solver::Path) {
+      if (++numb_found == 3) {
+        throw std::runtime_error("Abandon search");
+      }
+    };
+    try {
+      solver::solve(dict, grid, abandon, workspace);
+    } catch (const std::runtime_error&) {
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE("Solving with a pruned dictionary gives the same results",
+                   "[solve][prune]", WORDSEARCH_DICTIONARY_CLASSES) {
+  check_inputs();
+
+  const TestType dict{sort_unique(
+      utility::read_file_as_lines(test_cases_dirname / dictionary_filename))};
+  for (const auto& test_dir : fs::directory_iterator(test_cases_dirname)) {
+    if (!fs::is_directory(test_dir)) {
+      continue;
+    }
+    INFO(test_dir.path().string());
+    const auto grid = solver::make_grid(
+        utility::read_file_as_lines(test_dir / wordsearch_filename));
+
+    const auto pruned = solver::prune(dict, grid);
+    CHECK(pruned.size() <= dict.size());
+    for (std::size_t id = 0; id < pruned.size(); ++id) {
+      const auto word = pruned.word(id);
+      CHECK(word.size() <= grid.size());
+      CHECK(dict.contains(word));
+    }
+    CHECK(solver::solve(pruned, grid) == solver::solve(dict, grid));
+  }
+}
+
+TEST_CASE("Adjacent letters are those next to each other in the grid",
+          "[prune]") {
+  const auto grid = solver::make_grid({"abc", "dae"});
+  const solver::AdjacentLetters adjacent{grid};
+  CHECK(adjacent.contains('a', 'b'));
+  CHECK(adjacent.contains('b', 'a'));
+  CHECK(adjacent.contains('c', 'a'));
+  CHECK(adjacent.contains('a', 'a'));
+  CHECK(adjacent.contains('d', 'b'));
+  CHECK_FALSE(adjacent.contains('d', 'c'));
+  CHECK_FALSE(adjacent.contains('d', 'e'));
+  CHECK_FALSE(adjacent.contains('b', 'b'));
+  CHECK_FALSE(adjacent.contains('a', 'z'));
+}
+
+TEMPLATE_TEST_CASE("Straight line solve finds the straight paths solve finds",
+                   "[solve][straight_lines]", WORDSEARCH_DICTIONARY_CLASSES) {
+  check_inputs();
+
+  const auto dict_words = sort_unique(
+      utility::read_file_as_lines(test_cases_dirname / dictionary_filename));
+  const TestType dict{dict_words};
+  const solver::AhoCorasick automaton{dict_words};
+  REQUIRE(automaton.size() == dict.size());
+
+  const auto is_straight = [](const solver::Tail& tail) {
+    for (std::size_t i = 2; i < tail.size(); ++i) {
+      // Unsigned differences wrap, but equally for every step
+      if (tail[i].y - tail[i - 1].y != tail[1].y - tail[0].y ||
+          tail[i].x - tail[i - 1].x != tail[1].x - tail[0].x) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  for (const auto& test_dir : fs::directory_iterator(test_cases_dirname)) {
+    if (!fs::is_directory(test_dir)) {
+      continue;
+    }
+    INFO(test_dir.path().string());
+    const auto grid = solver::make_grid(
+        utility::read_file_as_lines(test_dir / wordsearch_filename));
+
+    solver::WordToListOfListsOfIndexes straight;
+    for (const auto& [word, list_of_indexes] : solver::solve(dict, grid)) {
+      for (const auto& tail : list_of_indexes) {
+        if (is_straight(tail)) {
+          straight[word].push_back(tail);
+        }
+      }
+    }
+    CHECK(solver::solve_straight_lines(automaton, grid) == straight);
+  }
+
+  // Children are looked up in the order std::string sorts chars, which puts
+  // those above 0x7f last
+  const solver::AhoCorasick high_chars{
+      std::vector<std::string>{"a\x7f", "ab", "a\xe9"}};
+  const auto found = solver::solve_straight_lines(
+      high_chars, solver::make_grid({"a\xe9", "b\x7f"}));
+  CHECK(found.count("a\xe9") == 1);
+  CHECK(found.count("ab") == 1);
+  CHECK(found.count("a\x7f") == 1);
+}
+
+TEMPLATE_TEST_CASE("Fixed size solve gives the same results as solve",
+                   "[solve][fixed]", WORDSEARCH_DICTIONARY_CLASSES) {
+  check_inputs();
+
+  const TestType dict{sort_unique(
+      utility::read_file_as_lines(test_cases_dirname / dictionary_filename))};
+
+  const auto boggle = solver::make_grid({"tsre", "oain", "lpet", "scdm"});
+  CHECK(solver::solve<4, 4>(dict, boggle) == solver::solve(dict, boggle));
+
+  const auto big_boggle =
+      solver::make_grid({"stare", "lpent", "ocida", "rsemu", "thing"});
+  CHECK(solver::solve<5, 5>(dict, big_boggle) ==
+        solver::solve(dict, big_boggle));
+
+  CHECK_THROWS_AS((solver::solve<5, 4>(dict, boggle)), std::runtime_error);
+}
+
+TEMPLATE_TEST_CASE("Evaluating boards counts what solve finds on each",
+                   "[solve][evaluate_boards]", WORDSEARCH_DICTIONARY_CLASSES) {
+  check_inputs();
+
+  const TestType dict{sort_unique(
+      utility::read_file_as_lines(test_cases_dirname / dictionary_filename))};
+
+  const std::vector<std::vector<std::string>> boards_lines{
+      {"tsre", "oain", "lpet", "scdm"},
+      {"qqqq", "qqqq", "qqqq", "qqqq"},
+      {"aaaa", "bbbb", "cccc", "dddd"},
+      {"hear", "tsog", "nilw", "ekam"},
+  };
+  std::string boards;
+  for (const auto& lines : boards_lines) {
+    for (const auto& line : lines) {
+      boards += line;
+    }
+  }
+
+  for (const std::size_t numb_threads : {1, 3}) {
+    const auto stats =
+        solver::evaluate_boards(dict, boards, 4, 4, numb_threads);
+    REQUIRE(stats.size() == boards_lines.size());
+    for (std::size_t i = 0; i < boards_lines.size(); ++i) {
+      const auto results =
+          solver::solve(dict, solver::make_grid(boards_lines[i]));
+      std::size_t numb_paths = 0;
+      std::size_t longest_word = 0;
+      for (const auto& [word, list_of_indexes] : results) {
+        numb_paths += list_of_indexes.size();
+        longest_word = std::max(longest_word, word.size());
+      }
+      CHECK(stats[i].numb_words == results.size());
+      CHECK(stats[i].numb_paths == numb_paths);
+      CHECK(stats[i].longest_word == longest_word);
+    }
+  }
+
+  CHECK_THROWS_AS(solver::evaluate_boards(dict, "abcde", 2, 2),
+                  std::runtime_error);
+}
+
+TEMPLATE_TEST_CASE("Solving with an adjacency keeps paths to its neighbours",
+                   "[solve][adjacency]", WORDSEARCH_DICTIONARY_CLASSES) {
+  check_inputs();
+
+  const TestType dict{sort_unique(
+      utility::read_file_as_lines(test_cases_dirname / dictionary_filename))};
+
+  const auto boggle = solver::make_grid({"tsre", "oain", "lpet", "scdm"});
+  const auto results = solver::solve(dict, boggle);
+  CHECK(solver::solve(dict, boggle, solver::Adjacency{4, 4}) == results);
+
+  // Paths from @p solved that only step between cells @p adjacent allows
+  const auto filter_solved = [](const auto& solved, const auto& adjacent) {
+    solver::WordToListOfListsOfIndexes filtered;
+    for (const auto& [word, list_of_indexes] : solved) {
+      for (const auto& indexes : list_of_indexes) {
+        bool keep = true;
+        for (std::size_t i = 0; i < indexes.size(); ++i) {
+          keep = keep && adjacent(indexes[i], i > 0 ? indexes[i - 1]
+                                                    : indexes[i]);
+        }
+        if (keep) {
+          filtered[word].push_back(indexes);
+        }
+      }
+    }
+    return filtered;
+  };
+  const auto filter = [&](const auto& adjacent) {
+    return filter_solved(results, adjacent);
+  };
+
+  const auto distance = [](const std::size_t a, const std::size_t b) {
+    return a > b ? a - b : b - a;
+  };
+  CHECK(solver::solve(dict, boggle,
+                      solver::Adjacency{4, 4, solver::Topology::four}) ==
+        filter([&distance](const solver::Index a, const solver::Index b) {
+          return distance(a.y, b.y) + distance(a.x, b.x) <= 1;
+        }));
+
+  // Odd rows are shifted right by half a cell, so from b the cells above and
+  // below are b.x - 1 and b.x on an even row, or b.x and b.x + 1 on an odd one
+  const auto hex_adjacent = [&distance](const solver::Index a,
+                                        const solver::Index b) {
+    if (a.y == b.y) {
+      return distance(a.x, b.x) <= 1;
+    }
+    const auto shift = b.y % 2;
+    return distance(a.y, b.y) == 1 && a.x + 1 >= b.x + shift &&
+           a.x <= b.x + shift;
+  };
+  CHECK(solver::solve(dict, boggle,
+                      solver::Adjacency{4, 4, solver::Topology::hex}) ==
+        filter(hex_adjacent));
+
+  // Over 64 cells, where the search keeps lists of neighbours rather than
+  // bitboards
+  const auto big = solver::make_grid({"tsreoain", "lpetscdm", "oainlpet",
+                                      "scdmtsre", "etsrnioa", "tepldmcs",
+                                      "aintsreo", "cdmslpet", "sreotain"});
+  const auto big_results = solver::solve(dict, big);
+  CHECK(solver::solve(dict, big, solver::Adjacency{9, 8}) == big_results);
+  CHECK(solver::solve(dict, big,
+                      solver::Adjacency{9, 8, solver::Topology::hex}) ==
+        filter_solved(big_results, hex_adjacent));
+
+  solver::Adjacency holes{4, 4};
+  holes.remove(solver::Index{1, 1});
+  holes.remove(solver::Index{3, 2});
+  CHECK(solver::solve(dict, boggle, holes) ==
+        filter([](const solver::Index a, const solver::Index) {
+          return !(a == solver::Index{1, 1}) && !(a == solver::Index{3, 2});
+        }));
+
+  // Every path on the rectangle is also one on the torus
+  auto torus = solver::solve(dict, boggle,
+                             solver::Adjacency{4, 4, solver::Topology::torus});
+  for (const auto& [word, list_of_indexes] : results) {
+    for (const auto& indexes : list_of_indexes) {
+      CHECK(std::find(torus[word].begin(), torus[word].end(), indexes) !=
+            torus[word].end());
+    }
+  }
+
+  CHECK_THROWS_AS(solver::solve(dict, boggle, solver::Adjacency{4, 5}),
+                  std::runtime_error);
+}
+
+TEMPLATE_TEST_CASE("The padded search of a large grid agrees with the "
+                   "unpadded one at its edges and corners",
+                   "[solve][padded]", WORDSEARCH_DICTIONARY_CLASSES) {
+  check_inputs();
+
+  const TestType dict{sort_unique(
+      utility::read_file_as_lines(test_cases_dirname / dictionary_filename))};
+
+  // All over 64 cells, so solve() searches them padded while solving with an
+  // Adjacency steps between lists of neighbours with no border. The thin ones
+  // are all edge.
+  const std::string letters = "tsreoainlpetscdm";
+  for (const auto [rows, cols] :
+       {std::pair<std::size_t, std::size_t>{9, 9}, {3, 30}, {30, 3}, {1, 70},
+        {70, 1}}) {
+    INFO(fmt::format("{} x {}", rows, cols));
+    std::vector<std::string> lines(rows, std::string(cols, 'a'));
+    for (std::size_t y = 0; y < rows; ++y) {
+      for (std::size_t x = 0; x < cols; ++x) {
+        lines[y][x] = letters[(y * 5 + x * 3) % letters.size()];
+      }
+    }
+    const auto grid = solver::make_grid(lines);
+    const auto unpadded =
+        solver::solve(dict, grid, solver::Adjacency{rows, cols});
+    CHECK(solver::solve(dict, grid) == unpadded);
+
+    std::vector<solver::Index> edges;
+    for (std::size_t y = 0; y < rows; ++y) {
+      for (std::size_t x = 0; x < cols; ++x) {
+        if (y == 0 || x == 0 || y + 1 == rows || x + 1 == cols) {
+          edges.push_back(solver::Index{y, x});
+        }
+      }
+    }
+    std::size_t numb_edge_paths = 0;
+    for (const auto start : edges) {
+      solver::WordToListOfListsOfIndexes expected;
+      for (const auto& [word, list_of_indexes] : unpadded) {
+        for (const auto& indexes : list_of_indexes) {
+          if (indexes.front() == start) {
+            expected[word].push_back(indexes);
+            ++numb_edge_paths;
+          }
+        }
+      }
+      solver::WordToListOfListsOfIndexes from_start;
+      solver::solve_index(dict, grid, start, from_start);
+      CHECK(from_start == expected);
+    }
+    CHECK(numb_edge_paths > 0);
+  }
+}
+
+TEMPLATE_TEST_CASE("Length limits keep only the words within them",
+                   "[solve][length_limits]", WORDSEARCH_DICTIONARY_CLASSES) {
+  check_inputs();
+
+  const auto dict_words = sort_unique(
+      utility::read_file_as_lines(test_cases_dirname / dictionary_filename));
+  const TestType dict{dict_words};
+
+  const auto boggle = solver::make_grid({"tsre", "oain", "lpet", "scdm"});
+  const auto results = solver::solve(dict, boggle);
+  CHECK(solver::solve(dict, boggle, solver::LengthLimits{}) == results);
+
+  for (const auto [min_length, max_length] :
+       {std::pair<std::size_t, std::size_t>{3, 12}, {1, 1}, {4, 4}, {0, 0}}) {
+    solver::WordToListOfListsOfIndexes expected;
+    for (const auto& [word, list_of_indexes] : results) {
+      if (word.size() >= min_length && word.size() <= max_length) {
+        expected.emplace(word, list_of_indexes);
+      }
+    }
+    const solver::LengthLimits limits{min_length, max_length};
+    CHECK(solver::solve(dict, boggle, limits) == expected);
+
+    // Without the longer words, the dictionary finds the same
+    const TestType short_dict{
+        utility::words_up_to_length(dict_words, max_length)};
+    CHECK(solver::solve(short_dict, boggle, limits) == expected);
+  }
+
+  CHECK_THROWS_AS(solver::solve(dict, boggle, solver::LengthLimits{5, 4}),
+                  std::runtime_error);
+}
+
+TEMPLATE_TEST_CASE("A solve session kept up to date matches solving again",
+                   "[solve][solve_session]", WORDSEARCH_DICTIONARY_CLASSES) {
+  check_inputs();
+
+  const TestType dict{sort_unique(
+      utility::read_file_as_lines(test_cases_dirname / dictionary_filename))};
+
+  auto grid = solver::make_grid({"tsre", "oain", "lpet", "scdm"});
+  solver::SolveSession<TestType> session{dict, grid};
+  CHECK(session.to_map() == solver::solve(dict, grid));
+
+  solver::Adjacency adjacency{grid.rows(), grid.columns()};
+  const auto check_edit = [&]() {
+    const auto expected = solver::solve(dict, grid, adjacency);
+    CHECK(session.to_map() == expected);
+    std::size_t numb_paths = 0;
+    for (const auto& [word, list_of_indexes] : expected) {
+      numb_paths += list_of_indexes.size();
+    }
+    CHECK(session.numb_paths() == numb_paths);
+  };
+
+  for (const auto& [index, c] :
+       {std::pair{solver::Index{1, 1}, 'e'}, {solver::Index{0, 3}, 'a'},
+        {solver::Index{3, 0}, 't'}, {solver::Index{1, 1}, 'r'}}) {
+    session.set_cell(index, c);
+    grid(index) = c;
+    check_edit();
+  }
+
+  session.clear_cell(solver::Index{2, 2});
+  adjacency.remove(solver::Index{2, 2});
+  CHECK(session.cleared(solver::Index{2, 2}));
+  check_edit();
+
+  session.set_cell(solver::Index{2, 2}, 's');
+  grid(solver::Index{2, 2}) = 's';
+  adjacency.restore(solver::Index{2, 2});
+  CHECK(!session.cleared(solver::Index{2, 2}));
+  check_edit();
+
+  CHECK_THROWS_AS(session.set_cell(solver::Index{4, 0}, 'a'),
+                  std::out_of_range);
+}
+
+TEMPLATE_TEST_CASE("A length limited solve session on a large grid matches "
+                   "solving again after random edits",
+                   "[solve][solve_session]", WORDSEARCH_DICTIONARY_CLASSES) {
+  check_inputs();
+
+  const TestType dict{sort_unique(
+      utility::read_file_as_lines(test_cases_dirname / dictionary_filename))};
+
+  // Short words only, so that each edit only searches again within a few
+  // cells of it, and the edits are spread over a grid far wider than that
+  const solver::LengthLimits limits{3, 5};
+  const std::size_t size = 14;
+  const std::string letters = "etaoinshrdlucmpgby";
+  std::mt19937 gen{42};
+  std::uniform_int_distribution<std::size_t> random_letter(0,
+                                                           letters.size() - 1);
+  std::uniform_int_distribution<std::size_t> random_coord(0, size - 1);
+
+  std::vector<std::string> rows(size, std::string(size, 'a'));
+  for (auto& row : rows) {
+    for (auto& c : row) {
+      c = letters[random_letter(gen)];
+    }
+  }
+  auto grid = solver::make_grid(rows);
+  solver::SolveSession<TestType> session{dict, grid, limits};
+  solver::Adjacency adjacency{size, size};
+
+  const auto check_edit = [&]() {
+    solver::WordToListOfListsOfIndexes expected;
+    for (auto& [word, list_of_indexes] :
+         solver::solve(dict, grid, adjacency)) {
+      if (word.size() >= limits.min_length &&
+          word.size() <= limits.max_length) {
+        expected[word] = std::move(list_of_indexes);
+      }
+    }
+    CHECK(session.to_map() == expected);
+  };
+  check_edit();
+
+  for (int edit = 0; edit < 60; ++edit) {
+    const solver::Index index{random_coord(gen), random_coord(gen)};
+    INFO(fmt::format("Edit {} at ({}, {})", edit, index.y, index.x));
+    if (edit % 4 == 3 && !session.cleared(index)) {
+      session.clear_cell(index);
+      adjacency.remove(index);
+    } else {
+      const auto c = letters[random_letter(gen)];
+      session.set_cell(index, c);
+      grid(index) = c;
+      adjacency.restore(index);
+    }
+    check_edit();
+  }
+}
+
+TEMPLATE_TEST_CASE("Streaming rows finds the same words as solve",
+                   "[solve][solve_stream]", WORDSEARCH_DICTIONARY_CLASSES) {
+  check_inputs();
+
+  const TestType dict{sort_unique(
+      utility::read_file_as_lines(test_cases_dirname / dictionary_filename))};
+
+  const std::vector<std::string> rows{"tsre", "oain", "lpet",
+                                      "scdm", "ehta", "rnol"};
+  const auto grid = solver::make_grid(rows);
+  for (const auto limits :
+       {solver::LengthLimits{}, solver::LengthLimits{3, 4}}) {
+    solver::SolveStream<TestType> stream{dict, grid.columns(), limits};
+    solver::WordToListOfListsOfIndexes found;
+    for (const auto& row : rows) {
+      const auto row_index = stream.rows();
+      stream.push_row(row, [&](const std::string_view word,
+                               const solver::Path path) {
+        // Every path is reported by the first row that completes it
+        CHECK(std::any_of(path.begin(), path.end(),
+                          [row_index](const solver::Index index) {
+                            return index.y == row_index;
+                          }));
+        found[std::string{word}].emplace_back(path.begin(), path.end());
+      });
+    }
+    CHECK(stream.rows() == rows.size());
+    // Rows push paths in a different order to solve()
+    solver::detail::sort_as_solved(found);
+    CHECK(found == solver::solve(dict, grid, limits));
+
+    CHECK_THROWS_AS(stream.push_row("tsr", [](auto&&...) {}),
+                    std::runtime_error);
+  }
+}
+
+TEMPLATE_TEST_CASE("Solving through a SolverDictWrapper matches solving "
+                   "directly",
+                   "[solve][solver_dict_wrapper]",
+                   WORDSEARCH_DICTIONARY_CLASSES) {
+  check_inputs();
+
+  const auto dict_words = sort_unique(
+      utility::read_file_as_lines(test_cases_dirname / dictionary_filename));
+  const TestType dict{dict_words};
+  const solver::SolverDictWrapper wrapper{std::in_place_type<TestType>,
+                                          dict_words};
+
+  const auto grid = solver::make_grid({"tsre", "oain", "lpet", "scdm"});
+  CHECK(solver::solve(wrapper, grid) == solver::solve(dict, grid));
+  CHECK(solver::solve<4, 4>(wrapper, grid) == solver::solve(dict, grid));
+  CHECK(solver::solve(wrapper, grid, solver::LengthLimits{3, 5}) ==
+        solver::solve(dict, grid, solver::LengthLimits{3, 5}));
+  CHECK(solver::solve(wrapper, grid, 2, solver::Schedule::work_stealing) ==
+        solver::solve(dict, grid));
+
+  solver::Adjacency adjacency{grid.rows(), grid.columns()};
+  adjacency.remove(solver::Index{1, 1});
+  CHECK(solver::solve(wrapper, grid, adjacency) ==
+        solver::solve(dict, grid, adjacency));
+
+  std::vector<std::size_t> wrapper_ids;
+  std::vector<std::size_t> dict_ids;
+  solver::solve_word_ids(wrapper, grid, [&](const std::size_t id, auto) {
+    wrapper_ids.push_back(id);
+  });
+  solver::solve_word_ids(dict, grid, [&](const std::size_t id, auto) {
+    dict_ids.push_back(id);
+  });
+  CHECK(wrapper_ids == dict_ids);
+
+  const std::string boards = "tsreoainlpetscdmeeeeabcdxyzqtrsa";
+  const auto wrapper_stats = solver::evaluate_boards(wrapper, boards, 4, 4, 1);
+  const auto dict_stats = solver::evaluate_boards(dict, boards, 4, 4, 1);
+  REQUIRE(wrapper_stats.size() == dict_stats.size());
+  for (std::size_t i = 0; i < dict_stats.size(); ++i) {
+    CHECK(wrapper_stats[i].numb_words == dict_stats[i].numb_words);
+    CHECK(wrapper_stats[i].numb_paths == dict_stats[i].numb_paths);
+    CHECK(wrapper_stats[i].longest_word == dict_stats[i].longest_word);
+  }
+}
@@ -14,6 +14,7 @@
 #include <iostream>
 #include <set>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -327,6 +328,82 @@ TEMPLATE_TEST_CASE("Contains_further test", "[contains_further]",
   }
 }
 
+TEMPLATE_TEST_CASE("Contains_further over a sequence of stems",
+                   "[contains_further]", WORDSEARCH_DICTIONARY_CLASSES) {
+  const std::vector<std::string> words{"ahem", "ahe", "aheaaa", "bah", "bahe"};
+  const TestType t{words};
+
+  // Stems that share, grow and shrink prefixes, as the solver would ask
+  const std::vector<std::string> stems{"",   "a",   "ah",  "ahe", "ahea",
+                                       "ah", "b",   "ba",  "bah", "ahe",
+                                       "",   "ahe", "bah", "z",   "ahea"};
+  for (const auto& stem : stems) {
+    INFO(fmt::format("Stem: \"{}\"\n", stem));
+    std::vector<std::pair<bool, bool>> result;
+    t.contains_further(stem, "aehmz", std::back_inserter(result));
+    CHECK(result == make_contains_and_further(t, stem, "aehmz"));
+  }
+}
+
+TEMPLATE_TEST_CASE("Cursor agrees with contains and further", "[cursor]",
+                   WORDSEARCH_DICTIONARY_CLASSES) {
+  const std::vector<std::string> words{"ahem", "ahe", "aheaaa", "bah", "bahe",
+                                       "z"};
+  const TestType t{words};
+
+  // Each word, plus the same with an extra letter that takes it off the end
+  std::vector<std::string> probes = words;
+  for (const auto& word : words) {
+    probes.push_back(word + "q");
+  }
+
+  for (const auto& probe : probes) {
+    auto cursor = t.root();
+    for (std::size_t i = 0; i < probe.size(); ++i) {
+      const std::string_view prefix{probe.data(), i + 1};
+      INFO(fmt::format("Prefix: {}\n", prefix));
+      const auto child = t.child(cursor, probe[i]);
+      CHECK(child.has_value() == (t.contains(prefix) || t.further(prefix)));
+      if (!child) {
+        break;
+      }
+      cursor = *child;
+      CHECK(t.is_word(cursor) == t.contains(prefix));
+      CHECK(t.has_further(cursor) == t.further(prefix));
+    }
+  }
+
+  CHECK(!t.is_word(t.root()));
+  CHECK(!t.child(t.root(), 'c'));
+}
+
+TEMPLATE_TEST_CASE("Word ids are dense and in sorted order", "[word_id]",
+                   WORDSEARCH_DICTIONARY_CLASSES) {
+  const std::vector<std::string> words{"ahem", "ahe",  "aheaaa", "bah",
+                                       "bahe", "z",    "ah",     "bahe",
+                                       "zz",   "abba", "b"};
+  const TestType t{words};
+  auto sorted = words;
+  std::sort(sorted.begin(), sorted.end());
+  sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+  REQUIRE(t.size() == sorted.size());
+
+  for (std::size_t id = 0; id < sorted.size(); ++id) {
+    const auto& word = sorted[id];
+    INFO(fmt::format("Word: {}\n", word));
+    auto cursor = t.root();
+    for (const auto c : word) {
+      const auto child = t.child(cursor, c);
+      REQUIRE(child);
+      cursor = *child;
+    }
+    REQUIRE(t.is_word(cursor));
+    CHECK(t.word_id(cursor) == id);
+    CHECK(t.word(id) == word);
+  }
+  CHECK_THROWS_AS(t.word(sorted.size()), std::out_of_range);
+}
+
 TEMPLATE_TEST_CASE("Test move cons", "[construct][further]",
                    WORDSEARCH_DICTIONARY_CLASSES) {
   const std::set<std::string> w{"hi", "there", "chum"};
@@ -467,3 +544,32 @@ TEMPLATE_TEST_CASE("Empty and size functions", "[empty][size]",
     CHECK(t.size() == 2);
   }
 }
+
+TEMPLATE_TEST_CASE("Max word length", "[max_word_length]",
+                   WORDSEARCH_DICTIONARY_CLASSES) {
+  CHECK(TestType{}.max_word_length() == 0);
+  CHECK(TestType{"hi"}.max_word_length() == 2);
+  CHECK(TestType{"a", "abcde", "bcd", "abc"}.max_word_length() == 5);
+}
+
+TEST_CASE("Compact tries built with a maximum length drop longer words",
+          "[construct][length_limits]") {
+  const std::vector<std::string> words{"a", "act", "acted", "actor", "actors"};
+  [[maybe_unused]] const auto check_short = [](const auto& t) {
+    CHECK(t.size() == 2);
+    CHECK(t.contains("a"));
+    CHECK(t.contains("act"));
+    CHECK(!t.contains("acted"));
+    CHECK(!t.further("act"));
+    CHECK(t.max_word_length() == 3);
+  };
+#ifdef WORDSEARCH_SOLVER_HAS_compact_trie
+  check_short(compact_trie::CompactTrie{words, 3});
+#endif
+#ifdef WORDSEARCH_SOLVER_HAS_compact_trie2
+  check_short(compact_trie2::CompactTrie2{words, 4});
+#endif
+#ifdef WORDSEARCH_SOLVER_HAS_compact_trie3
+  check_short(compact_trie3::CompactTrie3{words, 3});
+#endif
+}
@@ -9,6 +9,7 @@
 
 #include <bitset>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <ostream>
 #include <string_view>
@@ -48,6 +49,13 @@ public:
   Node* add_char(char c);
   void set_is_end_of_word(bool is_end_of_word);
 
+  /** Set by the owning trie once all words are inserted. The id of the first
+   * word, in sorted order, that has this node's prefix. If this node is a word
+   * end, that is this node's own word.
+   */
+  void set_first_word_id(std::uint32_t first_word_id);
+  std::uint32_t first_word_id() const;
+
   const Node* test(const char c) const;
   bool any() const;
   bool is_end_of_word() const;
@@ -63,6 +71,7 @@ public:
 
 private:
   Edges edges_;
+  std::uint32_t first_word_id_ = 0;
   bool is_end_of_word_;
 };
 
@@ -2,7 +2,6 @@
 #define TRIE_HPP
 
 #include "wordsearch_solver/trie/node.hpp"
-#include "wordsearch_solver/utility/flat_char_value_map.hpp"
 
 #include <fmt/core.h>
 #include <fmt/format.h>
@@ -13,6 +12,7 @@
 #include <cstdint>
 #include <initializer_list>
 #include <iterator>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <string_view>
@@ -48,11 +48,13 @@ namespace trie {
  * furthermore, since (in English at least) average word length is much shorter
  * than max(m) anyway, essentially this becomes almost constant time lookup.
  *
- * @note Not thread safe even for just reading, due to use of unprotected
- * internal cache.
+ * Immutable once constructed, so safe to read from multiple threads at once.
  */
 class Trie {
 public:
+  /** @copydoc solver::SolverDictWrapper::Cursor */
+  using Cursor = const Node*;
+
   Trie() = default;
 
   Trie(Trie&&) = default;
@@ -88,18 +90,37 @@ public:
                         const std::string_view suffixes,
                         OutputIterator contains_further_it) const;
 
+  /** @copydoc solver::SolverDictWrapper::root() */
+  Cursor root() const;
+  /** @copydoc solver::SolverDictWrapper::child() */
+  std::optional<Cursor> child(Cursor cursor, char c) const;
+  /** @copydoc solver::SolverDictWrapper::is_word() */
+  bool is_word(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::has_further() */
+  bool has_further(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::word_id() */
+  std::size_t word_id(Cursor cursor) const;
+  /** @copydoc solver::SolverDictWrapper::word() */
+  std::string word(std::size_t id) const;
+
   std::size_t size() const;
   bool empty() const;
+  /** @copydoc solver::SolverDictWrapper::max_word_length() */
+  std::size_t max_word_length() const;
 
   friend std::ostream& operator<<(std::ostream& os, const Trie& ct);
 
 private:
   const Node* search(std::string_view word) const;
   std::pair<Node*, bool> insert(std::string_view word);
+  /** Number every node once all words are inserted, see
+   * Node::first_word_id()
+   */
+  void assign_word_ids();
 
   Node root_;
   std::size_t size_;
-  mutable utility::FlatCharValueMap<const Node*> cache_;
+  std::size_t max_word_length_ = 0;
 };
 
 namespace detail {
@@ -10,6 +10,7 @@
 #include <range/v3/view/subrange.hpp>
 #include <range/v3/view/unique.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <iterator>
 #include <string>
@@ -27,20 +28,20 @@ Trie::Trie(Iterator1 first, const Iterator2 last)
 
 /** The constructor that actually does the work */
 template <class Strings>
-Trie::Trie(Strings&& strings_in) : root_{}, size_{}, cache_{} {
+Trie::Trie(Strings&& strings_in) : root_{}, size_{} {
   for (const auto& word : ranges::views::unique(strings_in)) {
     if (this->insert(word).second) {
       ++size_;
+      max_word_length_ = std::max(max_word_length_, word.size());
     }
   }
+  this->assign_word_ids();
 }
 
 template <class OutputIterator>
 void Trie::contains_further(const std::string_view stem,
                             const std::string_view suffixes,
-                            OutputIterator contains_further_it) const
-
-{
+                            OutputIterator contains_further_it) const {
   const auto* node = this->search(stem);
   if (!node) {
     return;
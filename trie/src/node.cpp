@@ -8,6 +8,7 @@
 #include <bitset>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <ostream>
@@ -78,6 +79,12 @@ const Node* Node::test(const char c) const {
   return it->child.get();
 }
 
+void Node::set_first_word_id(const std::uint32_t first_word_id) {
+  first_word_id_ = first_word_id;
+}
+
+std::uint32_t Node::first_word_id() const { return first_word_id_; }
+
 bool Node::any() const { return !edges_.empty(); }
 
 bool Node::is_end_of_word() const { return is_end_of_word_; }
@@ -13,9 +13,15 @@
 #include <range/v3/view/transform.hpp>
 #include <range/v3/view/zip.hpp>
 
+#include <algorithm>
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -50,10 +56,55 @@ bool Trie::further(const std::string_view word) const {
   return detail::further(root_, word);
 }
 
+Trie::Cursor Trie::root() const { return &root_; }
+
+std::optional<Trie::Cursor> Trie::child(const Cursor cursor,
+                                        const char c) const {
+  if (const auto* node = cursor->test(c)) {
+    return node;
+  }
+  return {};
+}
+
+bool Trie::is_word(const Cursor cursor) const {
+  return cursor->is_end_of_word();
+}
+
+bool Trie::has_further(const Cursor cursor) const { return cursor->any(); }
+
+std::size_t Trie::word_id(const Cursor cursor) const {
+  assert(cursor->is_end_of_word());
+  return cursor->first_word_id();
+}
+
+std::string Trie::word(const std::size_t id) const {
+  if (id >= size_) {
+    throw std::out_of_range("Word id out of range of trie");
+  }
+  std::string word;
+  const Node* node = &root_;
+  while (!(node->is_end_of_word() && node->first_word_id() == id)) {
+    // Each child's words follow on from its previous sibling's, so id is under
+    // the last child whose first word id isn't greater than it
+    const auto& edges = node->edges();
+    auto it = std::upper_bound(edges.begin(), edges.end(), id,
+                               [](const std::size_t id, const auto& edge) {
+                                 return id < edge.child->first_word_id();
+                               });
+    assert(it != edges.begin());
+    --it;
+    word.push_back(it->c);
+    node = it->child.get();
+  }
+  return word;
+}
+
 std::size_t Trie::size() const { return size_; }
 
 bool Trie::empty() const { return size_ == 0; }
 
+std::size_t Trie::max_word_length() const { return max_word_length_; }
+
 std::ostream& operator<<(std::ostream& os, const Trie& ct) {
   fmt::memory_buffer buff{};
   fmt::format_to(buff, "Size: {}\n", ct.size());
@@ -79,17 +130,6 @@ std::ostream& operator<<(std::ostream& os, const Trie& ct) {
  */
 const Node* Trie::search(std::string_view word) const {
   const Node* p = &root_;
-
-  const bool use_cache = true;
-  std::size_t i = 0;
-  if (use_cache) {
-    const auto* cached_result = cache_.lookup(word, i);
-    if (cached_result) {
-      word.remove_prefix(i);
-      p = *cached_result;
-    }
-  }
-
   for (; !word.empty(); word.remove_prefix(1)) {
     // fmt::print("p: {}\n", *p);
     const Node* next = p->test(word.front());
@@ -99,8 +139,6 @@ const Node* Trie::search(std::string_view word) const {
     }
     // fmt::print("next: {}\n", *next);
     p = next;
-    if (use_cache)
-      cache_.append(word.front(), p);
   }
   return p;
 }
@@ -123,6 +161,23 @@ std::pair<Node*, bool> Trie::insert(std::string_view word) {
   return {p, false};
 }
 
+void Trie::assign_word_ids() {
+  // Edges are sorted by char, so for ascii words a preorder traversal visits
+  // them in sorted order
+  std::uint32_t next_id = 0;
+  std::vector<Node*> stack{&root_};
+  while (!stack.empty()) {
+    Node* node = stack.back();
+    stack.pop_back();
+    node->set_first_word_id(next_id);
+    next_id += node->is_end_of_word();
+    const auto& edges = node->edges();
+    for (auto it = edges.rbegin(); it != edges.rend(); ++it) {
+      stack.push_back(it->child.get());
+    }
+  }
+}
+
 namespace detail {
 
 bool contains(const Node& node, const std::string_view word) {
@@ -26,6 +26,10 @@ namespace utility {
  * coroutines, allowing the solver dictionaries to write a tradional for loop
  * style solver that would keep all the appropriate state in scope managed by
  * the coroutine.
+ *
+ * The solver now walks the dictionaries a letter at a time with cursors (see
+ * solver::SolverDictWrapper::child()), which keeps that state in scope, so
+ * nothing uses this cache at the moment.
  */
 template <class Value> class FlatCharValueMap {
 public:
@@ -34,7 +38,10 @@ public:
   // Makes little sense to copy a cache from object to another, so just leave
   // the cache empty
   FlatCharValueMap(const FlatCharValueMap&) : FlatCharValueMap() {}
-  FlatCharValueMap& operator=(const FlatCharValueMap&) { this->clear(); }
+  FlatCharValueMap& operator=(const FlatCharValueMap&) {
+    this->clear();
+    return *this;
+  }
 
   // Move construction and move assignment both leave the cache in a default
   // constructed state, ie. as if clear() had been called. This is to prevent
@@ -1,6 +1,7 @@
 #ifndef UTILITY_UTILITY_HPP
 #define UTILITY_UTILITY_HPP
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -94,6 +95,18 @@ read_file_as_lines_keep_lowercase_ascii_only(const std::string& filepath);
  */
 template <class String> void throw_if_not_lowercase_ascii(const String& word);
 
+/** Copies out the words in @p words no longer than @p max_length
+ *
+ * Used to build a dictionary with no rows deeper than @p max_length, for
+ * searches that never look for longer words.
+ *
+ * @param[in] words A range of strings, in any order
+ * @param[in] max_length Length of the longest words to keep
+ */
+template <class Range>
+std::vector<std::string> words_up_to_length(const Range& words,
+                                            std::size_t max_length);
+
 /** Given a range `[1, 2, 3, 4]`, returns `[{1, 2}, {2, 3}, {3, 4}]`
  * @param[in] rng A forward range or better
  */
@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <fstream>
@@ -158,6 +159,19 @@ template <class String> void throw_if_not_lowercase_ascii(const String& word) {
   }
 }
 
+template <class Range>
+std::vector<std::string> words_up_to_length(const Range& words,
+                                            const std::size_t max_length) {
+  std::vector<std::string> kept;
+  for (const auto& word : words) {
+    const std::string_view word_view{word};
+    if (word_view.size() <= max_length) {
+      kept.emplace_back(word_view);
+    }
+  }
+  return kept;
+}
+
 template <class Range> auto make_adjacent_view(const Range& rng) {
   return ranges::views::zip(ranges::views::all(rng),
                             ranges::views::all(rng) | ranges::views::drop(1));